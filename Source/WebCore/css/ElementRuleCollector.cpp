@@ -329,8 +329,17 @@ void ElementRuleCollector::collectMatchingRulesForList(const RuleSet::RuleDataVe
         if (!ruleData.canMatchPseudoElement() && m_pseudoStyleRequest.pseudoId != NOPSEUDO)
             continue;
 
-        if (m_canUseFastReject && m_selectorFilter.fastRejectSelector<RuleData::maximumIdentifierCount>(ruleData.descendantSelectorIdentifierHashes()))
-            continue;
+        if (m_canUseFastReject) {
+            m_selectorFilter.didCheckCandidateRule();
+            if (m_selectorFilter.fastRejectSelector<RuleData::maximumIdentifierCount>(ruleData.descendantSelectorIdentifierHashes())) {
+                m_selectorFilter.didRejectByAncestors();
+                continue;
+            }
+            if (m_selectorFilter.fastRejectSiblingSelector<RuleData::maximumSiblingIdentifierCount>(ruleData.siblingSelectorIdentifierHashes())) {
+                m_selectorFilter.didRejectBySiblings();
+                continue;
+            }
+        }
 
         StyleRule* rule = ruleData.rule();
 
@@ -125,6 +125,33 @@ bool MediaQueryEvaluator::mediaTypeMatchSpecific(const char* mediaTypeToMatch) c
     return equalIgnoringCase(mediaTypeToMatch, m_mediaType);
 }
 
+MediaQueryViewportState::MediaQueryViewportState(Frame* frame)
+{
+    if (!frame)
+        return;
+    if (FrameView* view = frame->view()) {
+        layoutWidth = view->layoutWidth();
+        layoutHeight = view->layoutHeight();
+    }
+    if (RenderView* renderView = frame->document() ? frame->document()->renderView() : nullptr)
+        zoom = renderView->style().effectiveZoom();
+    if (Page* page = frame->page())
+        deviceScaleFactor = page->deviceScaleFactor();
+}
+
+unsigned MediaQueryViewportState::changedViewportDependencies(const MediaQueryViewportState& other) const
+{
+    // Width and height features are adjusted for zoom, so a zoom change affects both.
+    if (zoom != other.zoom || deviceScaleFactor != other.deviceScaleFactor)
+        return MediaQueryExp::ViewportWidthDependency | MediaQueryExp::ViewportHeightDependency;
+    unsigned changed = 0;
+    if (layoutWidth != other.layoutWidth)
+        changed |= MediaQueryExp::ViewportWidthDependency;
+    if (layoutHeight != other.layoutHeight)
+        changed |= MediaQueryExp::ViewportHeightDependency;
+    return changed;
+}
+
 static bool applyRestrictor(MediaQuery::Restrictor r, bool value)
 {
     return r == MediaQuery::Not ? !value : value;
@@ -37,6 +37,27 @@ class MediaQuerySet;
 class RenderStyle;
 class StyleResolver;
 
+// Snapshot of the frame state that viewport-dependent media features read. Layouts happen far more
+// often than viewport changes, so comparing snapshots lets callers skip re-evaluating media queries.
+struct MediaQueryViewportState {
+    MediaQueryViewportState() { }
+    explicit MediaQueryViewportState(Frame*);
+
+    bool operator==(const MediaQueryViewportState& other) const
+    {
+        return layoutWidth == other.layoutWidth && layoutHeight == other.layoutHeight && zoom == other.zoom && deviceScaleFactor == other.deviceScaleFactor;
+    }
+    bool operator!=(const MediaQueryViewportState& other) const { return !(*this == other); }
+
+    // Mask of MediaQueryExp::ViewportDependency bits whose inputs differ between the two snapshots.
+    unsigned changedViewportDependencies(const MediaQueryViewportState&) const;
+
+    int layoutWidth { 0 };
+    int layoutHeight { 0 };
+    float zoom { 1 };
+    float deviceScaleFactor { 1 };
+};
+
 /**
  * Class that evaluates css media queries as defined in
  * CSS3 Module "Media Queries" (http://www.w3.org/TR/css3-mediaqueries/)
@@ -46,6 +46,12 @@ public:
     CSSValue* value() const;
 
     bool isValid() const;
+    enum ViewportDependency {
+        ViewportWidthDependency = 1 << 0,
+        ViewportHeightDependency = 1 << 1
+    };
+    // Mask of ViewportDependency bits for the viewport dimensions this expression reads.
+    unsigned viewportDependencies() const;
     bool isViewportDependent() const;
 
     String serialize() const;
@@ -81,18 +87,27 @@ inline bool MediaQueryExp::isValid() const
     return m_isValid;
 }
 
-inline bool MediaQueryExp::isViewportDependent() const
+inline unsigned MediaQueryExp::viewportDependencies() const
 {
-    return m_mediaFeature == MediaFeatureNames::widthMediaFeature
-        || m_mediaFeature == MediaFeatureNames::heightMediaFeature
+    if (m_mediaFeature == MediaFeatureNames::widthMediaFeature
         || m_mediaFeature == MediaFeatureNames::min_widthMediaFeature
+        || m_mediaFeature == MediaFeatureNames::max_widthMediaFeature)
+        return ViewportWidthDependency;
+    if (m_mediaFeature == MediaFeatureNames::heightMediaFeature
         || m_mediaFeature == MediaFeatureNames::min_heightMediaFeature
-        || m_mediaFeature == MediaFeatureNames::max_widthMediaFeature
-        || m_mediaFeature == MediaFeatureNames::max_heightMediaFeature
-        || m_mediaFeature == MediaFeatureNames::orientationMediaFeature
+        || m_mediaFeature == MediaFeatureNames::max_heightMediaFeature)
+        return ViewportHeightDependency;
+    if (m_mediaFeature == MediaFeatureNames::orientationMediaFeature
         || m_mediaFeature == MediaFeatureNames::aspect_ratioMediaFeature
         || m_mediaFeature == MediaFeatureNames::min_aspect_ratioMediaFeature
-        || m_mediaFeature == MediaFeatureNames::max_aspect_ratioMediaFeature;
+        || m_mediaFeature == MediaFeatureNames::max_aspect_ratioMediaFeature)
+        return ViewportWidthDependency | ViewportHeightDependency;
+    return 0;
+}
+
+inline bool MediaQueryExp::isViewportDependent() const
+{
+    return viewportDependencies();
 }
 
 } // namespace
@@ -20,7 +20,10 @@
 #include "config.h"
 #include "MediaQueryList.h"
 
+#include "CSSPrimitiveValue.h"
 #include "MediaList.h"
+#include "MediaQuery.h"
+#include "MediaQueryExp.h"
 #include "MediaQueryEvaluator.h"
 #include "MediaQueryListListener.h"
 #include "MediaQueryMatcher.h"
@@ -73,6 +76,24 @@ void MediaQueryList::evaluate(MediaQueryEvaluator* evaluator, bool& notification
     notificationNeeded = m_changeRound == m_matcher->evaluationRound();
 }
 
+bool MediaQueryList::dependsOnlyOnViewportSize() const
+{
+    for (auto& query : m_media->queryVector()) {
+        // The media type can change without the viewport changing, e.g. when it is emulated.
+        if (query->expressions().isEmpty() || !(query->mediaType().isEmpty() || equalIgnoringCase(query->mediaType(), "all")))
+            return false;
+        for (auto& expression : query->expressions()) {
+            if (!expression->isViewportDependent())
+                return false;
+            // Font relative lengths are resolved against the root element style, which can change on its own.
+            CSSValue* value = expression->value();
+            if (is<CSSPrimitiveValue>(value) && downcast<CSSPrimitiveValue>(*value).isFontRelativeLength())
+                return false;
+        }
+    }
+    return true;
+}
+
 void MediaQueryList::setMatches(bool newValue)
 {
     m_evaluationRound = m_matcher->evaluationRound();
@@ -49,6 +49,10 @@ public:
 
     void evaluate(MediaQueryEvaluator*, bool& notificationNeeded);
 
+    // True if every query has no media type and only expressions reading the viewport size in absolute units,
+    // which MediaQueryViewportState covers.
+    bool dependsOnlyOnViewportSize() const;
+
 private:
     MediaQueryList(PassRefPtr<MediaQueryMatcher>, PassRefPtr<MediaQuerySet>, bool matches);
     void setMatches(bool);
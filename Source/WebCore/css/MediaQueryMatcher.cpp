@@ -43,12 +43,11 @@ MediaQueryMatcher::Listener::~Listener()
 {
 }
 
-void MediaQueryMatcher::Listener::evaluate(MediaQueryEvaluator* evaluator)
+bool MediaQueryMatcher::Listener::evaluate(MediaQueryEvaluator* evaluator)
 {
     bool notify;
     m_query->evaluate(evaluator, notify);
-    if (notify)
-        m_listener->queryChanged(m_query.get());
+    return notify;
 }
 
 MediaQueryMatcher::MediaQueryMatcher(Document* document)
@@ -135,17 +134,63 @@ void MediaQueryMatcher::removeListener(MediaQueryListListener* listener, MediaQu
     });
 }
 
+bool MediaQueryMatcher::isRegistered(MediaQueryListListener& listener, MediaQueryList* query) const
+{
+    for (auto& current : m_listeners) {
+        if (*current->listener() == listener && current->query() == query)
+            return true;
+    }
+    return false;
+}
+
 void MediaQueryMatcher::styleResolverChanged()
 {
     ASSERT(m_document);
 
     ++m_evaluationRound;
+    m_lastViewportState = MediaQueryViewportState(m_document->frame());
+
+    // Preparing the evaluator resolves the root element style, don't pay for it when nobody is listening.
+    if (m_listeners.isEmpty())
+        return;
+
     std::unique_ptr<MediaQueryEvaluator> evaluator = prepareEvaluator();
     if (!evaluator)
         return;
 
-    for (size_t i = 0; i < m_listeners.size(); ++i)
-        m_listeners[i]->evaluate(evaluator.get());
+    // Evaluate every query before notifying anyone, so that listeners adding or removing
+    // listeners, or changing the viewport, cannot disturb this round.
+    Vector<std::pair<RefPtr<MediaQueryListListener>, RefPtr<MediaQueryList>>> changedQueries;
+    for (auto& listener : m_listeners) {
+        if (listener->evaluate(evaluator.get()))
+            changedQueries.append(std::make_pair(listener->listener(), listener->query()));
+    }
+
+    Ref<MediaQueryMatcher> protect(*this);
+    for (auto& changedQuery : changedQueries) {
+        if (isRegistered(*changedQuery.first, changedQuery.second.get()))
+            changedQuery.first->queryChanged(changedQuery.second.get());
+    }
+}
+
+void MediaQueryMatcher::viewportMayHaveChanged()
+{
+    ASSERT(m_document);
+
+    // This runs before every layout. The snapshot only covers the viewport size features, so listeners on
+    // anything else (device-width, resolution, ...) are still re-evaluated every time, as before.
+    if (MediaQueryViewportState(m_document->frame()) == m_lastViewportState) {
+        bool listenersDependOnlyOnViewportSize = std::all_of(m_listeners.begin(), m_listeners.end(), [](const std::unique_ptr<Listener>& listener) {
+            return listener->query()->dependsOnlyOnViewportSize();
+        });
+        if (listenersDependOnlyOnViewportSize) {
+            // Let MediaQueryList::matches() re-evaluate lazily, any query may read more than the viewport.
+            ++m_evaluationRound;
+            return;
+        }
+    }
+
+    styleResolverChanged();
 }
 
 } // namespace WebCore
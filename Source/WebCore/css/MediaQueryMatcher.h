@@ -20,6 +20,7 @@
 #ifndef MediaQueryMatcher_h
 #define MediaQueryMatcher_h
 
+#include "MediaQueryEvaluator.h"
 #include <memory>
 #include <wtf/Forward.h>
 #include <wtf/RefCounted.h>
@@ -30,7 +31,6 @@ namespace WebCore {
 class Document;
 class MediaQueryList;
 class MediaQueryListListener;
-class MediaQueryEvaluator;
 class MediaQuerySet;
 
 // MediaQueryMatcher class is responsible for keeping a vector of pairs
@@ -51,6 +51,7 @@ public:
 
     unsigned evaluationRound() const { return m_evaluationRound; }
     void styleResolverChanged();
+    void viewportMayHaveChanged();
     bool evaluate(const MediaQuerySet*);
 
 private:
@@ -59,7 +60,7 @@ private:
         Listener(PassRefPtr<MediaQueryListListener>, PassRefPtr<MediaQueryList>);
         ~Listener();
 
-        void evaluate(MediaQueryEvaluator*);
+        bool evaluate(MediaQueryEvaluator*);
 
         MediaQueryListListener* listener() { return m_listener.get(); }
         MediaQueryList* query() { return m_query.get(); }
@@ -71,6 +72,7 @@ private:
 
     MediaQueryMatcher(Document*);
     std::unique_ptr<MediaQueryEvaluator> prepareEvaluator() const;
+    bool isRegistered(MediaQueryListListener&, MediaQueryList*) const;
     String mediaType() const;
 
     Document* m_document;
@@ -80,6 +82,8 @@ private:
     // It is used to avoid evaluating queries more then once and to make sure
     // that a media query result change is notified exactly once.
     unsigned m_evaluationRound;
+
+    MediaQueryViewportState m_lastViewportState;
 };
 
 } // namespace WebCore
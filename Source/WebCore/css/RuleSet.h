@@ -83,6 +83,8 @@ public:
     // Try to balance between memory usage (there can be lots of RuleData objects) and good filtering performance.
     static const unsigned maximumIdentifierCount = 4;
     const unsigned* descendantSelectorIdentifierHashes() const { return m_descendantSelectorIdentifierHashes; }
+    static const unsigned maximumSiblingIdentifierCount = 2;
+    const unsigned* siblingSelectorIdentifierHashes() const { return m_siblingSelectorIdentifierHashes; }
 
 #if ENABLE(CSS_SELECTOR_JIT)
     SelectorCompilationStatus compilationStatus() const { return m_compilationStatus; }
@@ -116,6 +118,7 @@ private:
     unsigned m_propertyWhitelistType : 2;
     // Use plain array instead of a Vector to minimize memory overhead.
     unsigned m_descendantSelectorIdentifierHashes[maximumIdentifierCount];
+    unsigned m_siblingSelectorIdentifierHashes[maximumSiblingIdentifierCount];
 #if ENABLE(CSS_SELECTOR_JIT)
     mutable SelectorCompilationStatus m_compilationStatus;
     mutable JSC::MacroAssemblerCodeRef m_compiledSelectorCodeRef;
@@ -139,6 +142,7 @@ struct SameSizeAsRuleData {
     unsigned b;
     unsigned c;
     unsigned d[4];
+    unsigned e[2];
 };
 
 COMPILE_ASSERT(sizeof(RuleData) == sizeof(SameSizeAsRuleData), RuleData_should_stay_small);
@@ -30,12 +30,20 @@
 #include "SelectorFilter.h"
 
 #include "CSSSelector.h"
+#include "ElementChildIterator.h"
 #include "StyledElement.h"
 
 namespace WebCore {
 
 // Salt to separate otherwise identical string hashes so a class-selector like .article won't match <article> elements.
-enum { TagNameSalt = 13, IdAttributeSalt = 17, ClassAttributeSalt = 19 };
+enum { TagNameSalt = 13, IdAttributeSalt = 17, ClassAttributeSalt = 19, AttributeNameSalt = 23 };
+
+// Attribute names are hashed lowercased on both sides. SelectorChecker compares them case-insensitively for HTML
+// elements only, so this can merely produce a false positive for other elements, never a false rejection.
+static inline unsigned attributeNameHash(const AtomicString& localName)
+{
+    return localName.convertToASCIILowercase().impl()->existingHash() * AttributeNameSalt;
+}
 
 static inline void collectElementIdentifierHashes(const Element* element, Vector<unsigned, 4>& identifierHashes)
 {
@@ -51,6 +59,12 @@ static inline void collectElementIdentifierHashes(const Element* element, Vector
         for (size_t i = 0; i < count; ++i)
             identifierHashes.append(classNames[i].impl()->existingHash() * ClassAttributeSalt);
     }
+    // Like SelectorChecker, synchronize the lazy style attribute and animated SVG attributes first
+    // so that the filter never rejects a selector on an attribute the element does have.
+    if (element->hasAttributes()) {
+        for (const Attribute& attribute : element->attributesIterator())
+            identifierHashes.append(attributeNameHash(attribute.localName()));
+    }
 }
 
 void SelectorFilter::pushParentStackFrame(Element* parent)
@@ -102,6 +116,28 @@ void SelectorFilter::setupParentStack(Element* parent)
         pushParentStackFrame(ancestors[n - 1]);
 }
 
+auto SelectorFilter::childIdentifierFilter(const ParentStackFrame& parentFrame) const -> const SiblingIdentifierFilter&
+{
+    uint64_t domTreeVersion = parentFrame.element->document().domTreeVersion();
+    if (parentFrame.childIdentifierFilter && parentFrame.childIdentifierFilterDOMTreeVersion == domTreeVersion)
+        return *parentFrame.childIdentifierFilter;
+
+    if (parentFrame.childIdentifierFilter)
+        parentFrame.childIdentifierFilter->clear();
+    else
+        parentFrame.childIdentifierFilter = std::make_unique<SiblingIdentifierFilter>();
+    parentFrame.childIdentifierFilterDOMTreeVersion = domTreeVersion;
+
+    Vector<unsigned, 4> identifierHashes;
+    for (auto& child : childrenOfType<Element>(*parentFrame.element)) {
+        identifierHashes.shrink(0);
+        collectElementIdentifierHashes(&child, identifierHashes);
+        for (unsigned hash : identifierHashes)
+            parentFrame.childIdentifierFilter->add(hash);
+    }
+    return *parentFrame.childIdentifierFilter;
+}
+
 void SelectorFilter::pushParent(Element* parent)
 {
     ASSERT(m_ancestorIdentifierFilter);
@@ -129,7 +165,18 @@ static inline void collectDescendantSelectorIdentifierHashes(const CSSSelector*
             (*hash++) = tagLowercaseLocalName.impl()->existingHash() * TagNameSalt;
         break;
     }
+    case CSSSelector::Exact:
+    case CSSSelector::Set:
+    case CSSSelector::List:
+    case CSSSelector::Hyphen:
+    case CSSSelector::Contain:
+    case CSSSelector::Begin:
+    case CSSSelector::End:
+        (*hash++) = attributeNameHash(selector->attribute().localName());
+        break;
     default:
+        // :not() and the other functional pseudo classes are skipped. The filter can only prove that
+        // an identifier is absent, which says nothing about whether a negation matches.
         break;
     }
 }
@@ -167,5 +214,37 @@ void SelectorFilter::collectIdentifierHashes(const CSSSelector* selector, unsign
     *hash = 0;
 }
 
+void SelectorFilter::collectSiblingIdentifierHashes(const CSSSelector* selector, unsigned* identifierHashes, unsigned maximumIdentifierCount)
+{
+    unsigned* hash = identifierHashes;
+    unsigned* end = identifierHashes + maximumIdentifierCount;
+    CSSSelector::Relation relation = selector->relation();
+
+    // Only collect identifiers of compound selectors that have to match siblings of the subject,
+    // that is, the ones chained to it by adjacent combinators only.
+    bool inSiblingCompound = false;
+    for (selector = selector->tagHistory(); selector; selector = selector->tagHistory()) {
+        switch (relation) {
+        case CSSSelector::SubSelector:
+            if (inSiblingCompound)
+                collectDescendantSelectorIdentifierHashes(selector, hash);
+            break;
+        case CSSSelector::DirectAdjacent:
+        case CSSSelector::IndirectAdjacent:
+            inSiblingCompound = true;
+            collectDescendantSelectorIdentifierHashes(selector, hash);
+            break;
+        case CSSSelector::Descendant:
+        case CSSSelector::Child:
+        case CSSSelector::ShadowDescendant:
+            *hash = 0;
+            return;
+        }
+        if (hash == end)
+            return;
+        relation = selector->relation();
+    }
+    *hash = 0;
 }
 
+}
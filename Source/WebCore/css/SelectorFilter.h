@@ -51,16 +51,41 @@ public:
 
     template <unsigned maximumIdentifierCount>
     inline bool fastRejectSelector(const unsigned* identifierHashes) const;
+    // Sibling rejection requires parentStackIsConsistent() to hold for the element being matched.
+    template <unsigned maximumIdentifierCount>
+    bool fastRejectSiblingSelector(const unsigned* siblingIdentifierHashes) const;
     static void collectIdentifierHashes(const CSSSelector*, unsigned* identifierHashes, unsigned maximumIdentifierCount);
+    static void collectSiblingIdentifierHashes(const CSSSelector*, unsigned* identifierHashes, unsigned maximumIdentifierCount);
+
+    struct Statistics {
+        unsigned candidateRuleCount { 0 };
+        unsigned ancestorRejectionCount { 0 };
+        unsigned siblingRejectionCount { 0 };
+    };
+    const Statistics& statistics() const { return m_statistics; }
+    void resetStatistics() { m_statistics = Statistics(); }
+    void didCheckCandidateRule() const { ++m_statistics.candidateRuleCount; }
+    void didRejectByAncestors() const { ++m_statistics.ancestorRejectionCount; }
+    void didRejectBySiblings() const { ++m_statistics.siblingRejectionCount; }
 
 private:
+    // The sibling filter is only needed by rules with adjacent combinators so it is built lazily.
+    // It is invalidated by any DOM mutation since the parent stack survives across parser chunks.
+    static const unsigned siblingFilterKeyBits = 10;
+    typedef BloomFilter<siblingFilterKeyBits> SiblingIdentifierFilter;
+
     struct ParentStackFrame {
         ParentStackFrame() : element(0) { }
         ParentStackFrame(Element* element) : element(element) { }
         Element* element;
         Vector<unsigned, 4> identifierHashes;
+        mutable std::unique_ptr<SiblingIdentifierFilter> childIdentifierFilter;
+        mutable uint64_t childIdentifierFilterDOMTreeVersion { 0 };
     };
+    const SiblingIdentifierFilter& childIdentifierFilter(const ParentStackFrame&) const;
+
     Vector<ParentStackFrame> m_parentStack;
+    mutable Statistics m_statistics;
 
     // With 100 unique strings in the filter, 2^12 slot table has false positive rate of ~0.2%.
     static const unsigned bloomFilterKeyBits = 12;
@@ -78,6 +103,20 @@ inline bool SelectorFilter::fastRejectSelector(const unsigned* identifierHashes)
     return false;
 }
 
+template <unsigned maximumIdentifierCount>
+inline bool SelectorFilter::fastRejectSiblingSelector(const unsigned* siblingIdentifierHashes) const
+{
+    if (!siblingIdentifierHashes[0])
+        return false;
+    ASSERT(!m_parentStack.isEmpty());
+    const SiblingIdentifierFilter& filter = childIdentifierFilter(m_parentStack.last());
+    for (unsigned n = 0; n < maximumIdentifierCount && siblingIdentifierHashes[n]; ++n) {
+        if (!filter.mayContain(siblingIdentifierHashes[n]))
+            return true;
+    }
+    return false;
+}
+
 }
 
 #endif
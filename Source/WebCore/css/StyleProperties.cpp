@@ -87,6 +87,7 @@ MutableStyleProperties::~MutableStyleProperties()
 
 ImmutableStyleProperties::ImmutableStyleProperties(const CSSProperty* properties, unsigned length, CSSParserMode cssParserMode)
     : StyleProperties(cssParserMode, length)
+    , m_propertyIDFilter(0)
 {
     StylePropertyMetadata* metadataArray = const_cast<StylePropertyMetadata*>(this->metadataArray());
     CSSValue** valueArray = const_cast<CSSValue**>(this->valueArray());
@@ -94,6 +95,9 @@ ImmutableStyleProperties::ImmutableStyleProperties(const CSSProperty* properties
         metadataArray[i] = properties[i].metadata();
         valueArray[i] = properties[i].value();
         valueArray[i]->ref();
+        m_propertyIDFilter |= propertyIDFilterBit(properties[i].id());
+        if (properties[i].isImportant())
+            m_hasImportantProperties = true;
     }
 }
 
@@ -1228,6 +1232,9 @@ int ImmutableStyleProperties::findPropertyIndex(CSSPropertyID propertyID) const
 {
     // Convert here propertyID into an uint16_t to compare it with the metadata's m_propertyID to avoid
     // the compiler converting it to an int multiple times in the loop.
+    if (!mayContainProperty(propertyID))
+        return -1;
+
     uint16_t id = static_cast<uint16_t>(propertyID);
     for (int n = m_arraySize - 1 ; n >= 0; --n) {
         if (metadataArray()[n].m_propertyID == id)
@@ -1252,6 +1259,9 @@ int MutableStyleProperties::findPropertyIndex(CSSPropertyID propertyID) const
 
 int ImmutableStyleProperties::findCustomPropertyIndex(const String& propertyName) const
 {
+    if (!mayContainProperty(CSSPropertyCustom))
+        return -1;
+
     // Convert the propertyID into an uint16_t to compare it with the metadata's m_propertyID to avoid
     // the compiler converting it to an int multiple times in the loop.
     for (int n = m_arraySize - 1 ; n >= 0; --n) {
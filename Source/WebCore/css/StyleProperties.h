@@ -112,6 +112,9 @@ public:
     bool isMutable() const { return m_isMutable; }
     bool hasCSSOMWrapper() const;
 
+    // Only tracked for immutable properties, mutable ones always report true.
+    bool mayHaveImportantProperties() const { return m_isMutable || m_hasImportantProperties; }
+
     bool traverseSubresources(const std::function<bool (const CachedResource&)>& handler) const;
 
     static unsigned averageSizeInBytes();
@@ -126,12 +129,14 @@ protected:
     StyleProperties(CSSParserMode cssParserMode)
         : m_cssParserMode(cssParserMode)
         , m_isMutable(true)
+        , m_hasImportantProperties(false)
         , m_arraySize(0)
     { }
 
     StyleProperties(CSSParserMode cssParserMode, unsigned immutableArraySize)
         : m_cssParserMode(cssParserMode)
         , m_isMutable(false)
+        , m_hasImportantProperties(false)
         , m_arraySize(immutableArraySize)
     { }
 
@@ -140,7 +145,8 @@ protected:
     
     unsigned m_cssParserMode : 2;
     mutable unsigned m_isMutable : 1;
-    unsigned m_arraySize : 29;
+    unsigned m_hasImportantProperties : 1;
+    unsigned m_arraySize : 28;
     
 private:
     String getShorthandValue(const StylePropertyShorthand&) const;
@@ -169,11 +175,18 @@ public:
     const StylePropertyMetadata* metadataArray() const;
     int findPropertyIndex(CSSPropertyID) const;
     int findCustomPropertyIndex(const String& propertyName) const;
-    
-    void* m_storage;
+
+    bool mayContainProperty(CSSPropertyID propertyID) const { return m_propertyIDFilter & propertyIDFilterBit(propertyID); }
 
 private:
     ImmutableStyleProperties(const CSSProperty*, unsigned count, CSSParserMode);
+
+    static uint64_t propertyIDFilterBit(unsigned propertyID) { return static_cast<uint64_t>(1) << (propertyID % 64); }
+
+    // One bit per property ID modulo 64, so that lookups for most absent properties do not scan the metadata.
+    uint64_t m_propertyIDFilter;
+    // The value and metadata arrays are allocated right after the object, starting here; this must stay the last member.
+    void* m_storage;
 };
 
 inline const CSSValue** ImmutableStyleProperties::valueArray() const
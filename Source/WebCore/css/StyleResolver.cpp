@@ -192,6 +192,8 @@ public:
     void applyDeferredProperties(StyleResolver&);
 
     HashMap<AtomicString, Property>& customProperties() { return m_customProperties; }
+
+    unsigned declarationCount() const { return m_declarationCount; }
     
 private:
     void addStyleProperties(const StyleProperties&, StyleRule&, bool isImportant, bool inheritedOnly, PropertyWhitelistType, unsigned linkMatchType);
@@ -205,6 +207,7 @@ private:
 
     TextDirection m_direction;
     WritingMode m_writingMode;
+    unsigned m_declarationCount { 0 };
 };
 
 static void extractDirectionAndWritingMode(const RenderStyle&, const StyleResolver::MatchResult&, TextDirection&, WritingMode&);
@@ -692,36 +695,124 @@ inline StyledElement* StyleResolver::findSiblingForStyleSharing(Node* node, unsi
     return downcast<StyledElement>(node);
 }
 
+static inline bool parentCanShareChildStylesWithCousins(const Element* parent, const DocumentRuleSets& ruleSets)
+{
+    // Mirrors the requirements locateCousinList() puts on the parents it climbs through.
+    if (!is<StyledElement>(parent))
+        return false;
+    const StyledElement& styledParent = downcast<StyledElement>(*parent);
+    if (styledParent.inlineStyle())
+        return false;
+    if (is<SVGElement>(styledParent) && downcast<SVGElement>(styledParent).animatedSMILStyleProperties())
+        return false;
+    if (styledParent.hasID() && ruleSets.features().idsInRules.contains(styledParent.idForStyleResolution().impl()))
+        return false;
+    return !parentElementPreventsSharing(&styledParent);
+}
+
+unsigned StyleResolver::styleSharingIndexKey() const
+{
+    const State& state = m_state;
+    StyledElement& element = *state.styledElement();
+
+    unsigned classNamesHash = 0;
+    if (element.hasClass()) {
+        const SpaceSplitString& classNames = element.classNames();
+        for (unsigned i = 0; i < classNames.size(); ++i)
+            classNamesHash = WTF::pairIntHash(classNamesHash, classNames[i].impl()->existingHash());
+    }
+
+    struct {
+        const void* localName;
+        const void* presentationAttributeStyle;
+        const void* parentStyle;
+        unsigned classNamesHash;
+        unsigned isLink;
+    } key = { element.localName().impl(), element.presentationAttributeStyle(), state.parentStyle(), classNamesHash, element.isLink() };
+    return StringHasher::hashMemory(&key, sizeof(key));
+}
+
+StyledElement* StyleResolver::findStyleSharingCandidateInIndex(unsigned key) const
+{
+    const State& state = m_state;
+    StyledElement* candidate = m_styleSharingIndex.get(key);
+    if (!candidate || candidate == state.element())
+        return nullptr;
+
+    Element* parent = state.element()->parentElement();
+    Element* candidateParent = candidate->parentElement();
+    if (!parent || !candidateParent)
+        return nullptr;
+    // Cousins at any distance can share as long as their parents share a style.
+    if (candidateParent != parent) {
+        if (candidateParent->renderStyle() != state.parentStyle())
+            return nullptr;
+        if (!parentCanShareChildStylesWithCousins(parent, m_ruleSets) || !parentCanShareChildStylesWithCousins(candidateParent, m_ruleSets))
+            return nullptr;
+    }
+    if (!canShareStyleWithElement(candidate))
+        return nullptr;
+    return candidate;
+}
+
+void StyleResolver::addToStyleSharingIndex(unsigned key)
+{
+    // Only called once the element has passed the sharing checks. canShareStyleWithElement() also rejects these
+    // elements as candidates, recording them would only push a usable candidate out of the index.
+    StyledElement& element = *m_state.styledElement();
+    if (element.hasTagName(iframeTag) || element.hasTagName(frameTag) || element.hasTagName(embedTag) || element.hasTagName(objectTag) || element.hasTagName(appletTag) || element.hasTagName(canvasTag))
+        return;
+    if (element.affectsNextSiblingElementStyle() || element.styleIsAffectedByPreviousSibling())
+        return;
+    m_styleSharingIndex.set(key, &element);
+}
+
+RenderStyle* StyleResolver::didNotShareStyle(StyleSharingMissReason reason)
+{
+    ++m_styleSharingStatistics.missCounts[static_cast<unsigned>(reason)];
+    return nullptr;
+}
+
 RenderStyle* StyleResolver::locateSharedStyle()
 {
     State& state = m_state;
     if (!state.styledElement() || !state.parentStyle())
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
 
     // If the element has inline style it is probably unique.
     if (state.styledElement()->inlineStyle())
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
     if (state.styledElement()->isSVGElement() && downcast<SVGElement>(*state.styledElement()).animatedSMILStyleProperties())
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
     // Ids stop style sharing if they show up in the stylesheets.
     if (state.styledElement()->hasID() && m_ruleSets.features().idsInRules.contains(state.styledElement()->idForStyleResolution().impl()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
     if (parentElementPreventsSharing(state.element()->parentElement()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ParentPreventsSharing);
     if (state.element() == state.document().cssTarget())
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
     if (elementHasDirectionAuto(state.element()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ElementNotShareable);
 
     // Cache whether state.element is affected by any known class selectors.
     // FIXME: This shouldn't be a member variable. The style sharing code could be factored out of StyleResolver.
     state.setElementAffectedByClassRules(state.element() && state.element()->hasClass() && classNamesAffectedByRules(state.element()->classNames()));
 
-    // Check previous siblings and their cousins.
+    // The index holds raw element pointers, which are only safe while the DOM is unchanged.
+    uint64_t domTreeVersion = state.document().domTreeVersion();
+    if (m_styleSharingIndexDOMTreeVersion != domTreeVersion) {
+        m_styleSharingIndex.clear();
+        m_styleSharingIndexDOMTreeVersion = domTreeVersion;
+    }
+
+    // Look up the last element resolved with the same sharing key first, then check previous siblings and their cousins.
+    unsigned indexKey = styleSharingIndexKey();
+    StyledElement* shareElement = findStyleSharingCandidateInIndex(indexKey);
+    bool foundInIndex = shareElement;
+
     unsigned count = 0;
     unsigned visitedNodeCount = 0;
-    StyledElement* shareElement = nullptr;
-    Node* cousinList = state.styledElement()->previousSibling();
+    Node* cousinList = shareElement ? nullptr : state.styledElement()->previousSibling();
     while (cousinList) {
         shareElement = findSiblingForStyleSharing(cousinList, count);
         if (shareElement)
@@ -730,18 +821,28 @@ RenderStyle* StyleResolver::locateSharedStyle()
     }
 
     // If we have exhausted all our budget or our cousins.
-    if (!shareElement)
-        return nullptr;
+    if (!shareElement) {
+        // Still index the element for later lookups, unless it would fail the checks below once it had a candidate.
+        if (!styleSharingCandidateMatchesRuleSet(m_ruleSets.sibling()) && !styleSharingCandidateMatchesRuleSet(m_ruleSets.uncommonAttribute()))
+            addToStyleSharingIndex(indexKey);
+        return didNotShareStyle(StyleSharingMissReason::NoCandidate);
+    }
 
     // Can't share if sibling rules apply. This is checked at the end as it should rarely fail.
     if (styleSharingCandidateMatchesRuleSet(m_ruleSets.sibling()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::SiblingRules);
     // Can't share if attribute rules apply.
     if (styleSharingCandidateMatchesRuleSet(m_ruleSets.uncommonAttribute()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::UncommonAttributeRules);
     // Tracking child index requires unique style for each node. This may get set by the sibling rule match above.
     if (parentElementPreventsSharing(state.element()->parentElement()))
-        return nullptr;
+        return didNotShareStyle(StyleSharingMissReason::ParentPreventsSharing);
+
+    addToStyleSharingIndex(indexKey);
+    if (foundInIndex)
+        ++m_styleSharingStatistics.indexHitCount;
+    else
+        ++m_styleSharingStatistics.scanHitCount;
     return shareElement->renderStyle();
 }
 
@@ -850,6 +951,7 @@ Ref<RenderStyle> StyleResolver::styleForKeyframe(const RenderStyle* elementStyle
     // decl, there's nothing to override. So just add the first properties.
     CascadedProperties cascade(direction, writingMode);
     cascade.addMatches(result, false, 0, result.matchedProperties().size() - 1);
+    m_cascadeStatistics.cascadedDeclarationCount += cascade.declarationCount();
     
     // Resolve custom properties first.
     applyCascadedProperties(cascade, CSSPropertyCustom, CSSPropertyCustom);
@@ -1018,6 +1120,7 @@ Ref<RenderStyle> StyleResolver::styleForPage(int pageIndex)
 
     CascadedProperties cascade(direction, writingMode);
     cascade.addMatches(result, false, 0, result.matchedProperties().size() - 1);
+    m_cascadeStatistics.cascadedDeclarationCount += cascade.declarationCount();
 
     // Resolve custom properties first.
     applyCascadedProperties(cascade, CSSPropertyCustom, CSSPropertyCustom);
@@ -1694,6 +1797,7 @@ void StyleResolver::applyMatchedProperties(const MatchResult& matchResult, const
         CascadedProperties cascade(direction, writingMode);
         cascade.addMatches(matchResult, false, matchResult.ranges.firstUARule, matchResult.ranges.lastUARule, applyInheritedOnly);
         cascade.addMatches(matchResult, true, matchResult.ranges.firstUARule, matchResult.ranges.lastUARule, applyInheritedOnly);
+        m_cascadeStatistics.cascadedDeclarationCount += cascade.declarationCount();
 
         applyCascadedProperties(cascade, CSSPropertyWebkitRubyPosition, CSSPropertyWebkitRubyPosition);
         adjustStyleForInterCharacterRuby();
@@ -1715,7 +1819,8 @@ void StyleResolver::applyMatchedProperties(const MatchResult& matchResult, const
     cascade.addMatches(matchResult, true, matchResult.ranges.firstAuthorRule, matchResult.ranges.lastAuthorRule, applyInheritedOnly);
     cascade.addMatches(matchResult, true, matchResult.ranges.firstUserRule, matchResult.ranges.lastUserRule, applyInheritedOnly);
     cascade.addMatches(matchResult, true, matchResult.ranges.firstUARule, matchResult.ranges.lastUARule, applyInheritedOnly);
-    
+    m_cascadeStatistics.cascadedDeclarationCount += cascade.declarationCount();
+
     // Resolve custom properties first.
     applyCascadedProperties(cascade, CSSPropertyCustom, CSSPropertyCustom);
 
@@ -2127,16 +2232,36 @@ Color StyleResolver::colorFromPrimitiveValue(CSSPrimitiveValue& value, bool forV
 
 void StyleResolver::addViewportDependentMediaQueryResult(const MediaQueryExp* expr, bool result)
 {
+    // Stylesheets tend to repeat the same few breakpoints in many @media blocks, keep each result once.
+    for (auto& existingResult : m_viewportDependentMediaQueryResults) {
+        if (existingResult->m_result == result && existingResult->m_expression == *expr)
+            return;
+    }
+    if (m_viewportDependentMediaQueryResults.isEmpty())
+        m_viewportStateForMediaQueryResults = MediaQueryViewportState(m_document.frame());
     m_viewportDependentMediaQueryResults.append(std::make_unique<MediaQueryResult>(*expr, result));
 }
 
 bool StyleResolver::hasMediaQueriesAffectedByViewportChange() const
 {
-    unsigned s = m_viewportDependentMediaQueryResults.size();
-    for (unsigned i = 0; i < s; i++) {
-        if (m_medium->eval(&m_viewportDependentMediaQueryResults[i]->m_expression) != m_viewportDependentMediaQueryResults[i]->m_result)
+    if (m_viewportDependentMediaQueryResults.isEmpty())
+        return false;
+
+    // Most layouts do not change the viewport. When it does change, only re-evaluate the expressions
+    // reading the dimensions that changed; a resize that crosses no breakpoint keeps this StyleResolver.
+    MediaQueryViewportState viewportState(m_document.frame());
+    unsigned changedDependencies = viewportState.changedViewportDependencies(m_viewportStateForMediaQueryResults);
+    if (!changedDependencies)
+        return false;
+
+    for (auto& result : m_viewportDependentMediaQueryResults) {
+        if (!(result->m_expression.viewportDependencies() & changedDependencies))
+            continue;
+        if (m_medium->eval(&result->m_expression) != result->m_result)
             return true;
     }
+
+    m_viewportStateForMediaQueryResults = viewportState;
     return false;
 }
 
@@ -2586,6 +2711,10 @@ void StyleResolver::CascadedProperties::setDeferred(CSSPropertyID id, CSSValue&
 
 void StyleResolver::CascadedProperties::addStyleProperties(const StyleProperties& properties, StyleRule&, bool isImportant, bool inheritedOnly, PropertyWhitelistType propertyWhitelistType, unsigned linkMatchType)
 {
+    // Most declaration blocks have no !important declarations, don't walk them again for the important pass.
+    if (isImportant && !properties.mayHaveImportantProperties())
+        return;
+
     for (unsigned i = 0, count = properties.propertyCount(); i < count; ++i) {
         auto current = properties.propertyAt(i);
         if (isImportant != current.isImportant())
@@ -2605,6 +2734,7 @@ void StyleResolver::CascadedProperties::addStyleProperties(const StyleProperties
             continue;
 #endif
 
+        ++m_declarationCount;
         if (shouldApplyPropertyInParseOrder(propertyID))
             setDeferred(propertyID, *current.value(), linkMatchType);
         else
@@ -2632,6 +2762,7 @@ void StyleResolver::CascadedProperties::applyDeferredProperties(StyleResolver& r
 void StyleResolver::CascadedProperties::Property::apply(StyleResolver& resolver)
 {
     State& state = resolver.state();
+    ++resolver.m_cascadeStatistics.appliedPropertyCount;
 
     if (cssValue[0]) {
         state.setApplyPropertyToRegularStyle(true);
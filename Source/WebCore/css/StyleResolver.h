@@ -28,6 +28,7 @@
 #include "DocumentRuleSets.h"
 #include "InspectorCSSOMWrappers.h"
 #include "LinkHash.h"
+#include "MediaQueryEvaluator.h"
 #include "MediaQueryExp.h"
 #include "RenderStyle.h"
 #include "RuleFeature.h"
@@ -38,6 +39,7 @@
 #include "SelectorFilter.h"
 #include "StyleInheritedData.h"
 #include "ViewportStyleResolver.h"
+#include <array>
 #include <memory>
 #include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
@@ -170,13 +172,42 @@ public:
 
     const MediaQueryEvaluator& mediaQueryEvaluator() const { return *m_medium; }
 
+    enum class StyleSharingMissReason {
+        ElementNotShareable,
+        NoCandidate,
+        SiblingRules,
+        UncommonAttributeRules,
+        ParentPreventsSharing
+    };
+    static const unsigned styleSharingMissReasonCount = 5;
+    struct StyleSharingStatistics {
+        unsigned indexHitCount { 0 };
+        unsigned scanHitCount { 0 };
+        std::array<unsigned, styleSharingMissReasonCount> missCounts {{ }};
+    };
+    const StyleSharingStatistics& styleSharingStatistics() const { return m_styleSharingStatistics; }
+    void resetStyleSharingStatistics() { m_styleSharingStatistics = StyleSharingStatistics(); }
+
+    // Declarations the matched rules handed to the cascade, and the properties left to apply once shadowed
+    // declarations have been dropped.
+    struct CascadeStatistics {
+        unsigned cascadedDeclarationCount { 0 };
+        unsigned appliedPropertyCount { 0 };
+    };
+    const CascadeStatistics& cascadeStatistics() const { return m_cascadeStatistics; }
+    void resetCascadeStatistics() { m_cascadeStatistics = CascadeStatistics(); }
+
 private:
     void initElement(Element*);
     RenderStyle* locateSharedStyle();
+    RenderStyle* didNotShareStyle(StyleSharingMissReason);
     bool styleSharingCandidateMatchesRuleSet(RuleSet*);
     Node* locateCousinList(Element* parent, unsigned& visitedNodeCount) const;
     StyledElement* findSiblingForStyleSharing(Node*, unsigned& count) const;
     bool canShareStyleWithElement(StyledElement*) const;
+    unsigned styleSharingIndexKey() const;
+    StyledElement* findStyleSharingCandidateInIndex(unsigned key) const;
+    void addToStyleSharingIndex(unsigned key);
 
     Ref<RenderStyle> styleForKeyframe(const RenderStyle*, const StyleKeyframe*, KeyframeValue&);
 
@@ -511,7 +542,16 @@ private:
 
     bool m_matchAuthorAndUserStyles;
 
+    // Most recently resolved element per sharing key (tag, classes, presentation attributes, link state,
+    // parent style). Candidates are re-validated on use, the index is dropped on any DOM mutation.
+    HashMap<unsigned, StyledElement*> m_styleSharingIndex;
+    uint64_t m_styleSharingIndexDOMTreeVersion { 0 };
+    StyleSharingStatistics m_styleSharingStatistics;
+    CascadeStatistics m_cascadeStatistics;
+
+    // Distinct viewport-dependent expression results, valid for m_viewportStateForMediaQueryResults.
     Vector<std::unique_ptr<MediaQueryResult>> m_viewportDependentMediaQueryResults;
+    mutable MediaQueryViewportState m_viewportStateForMediaQueryResults;
 
 #if ENABLE(CSS_DEVICE_ADAPTATION)
     RefPtr<ViewportStyleResolver> m_viewportStyleResolver;
@@ -43,7 +43,9 @@ public:
     NodeType* nodeAt(const Collection&, unsigned index);
 
     bool hasValidCache(const Collection& collection) const { return m_current != collection.collectionEnd() || m_nodeCountValid || m_listValid; }
+    bool hasCompleteList() const { return m_listValid; }
     void invalidate(const Collection&);
+    void didAppendNodes(const Collection&, const Vector<NodeType*>&);
     size_t memoryCost() { return m_cachedList.capacity() * sizeof(NodeType*); }
 
 private:
@@ -221,6 +223,22 @@ void CollectionIndexCache<Collection, Iterator>::invalidate(const Collection& co
     m_cachedList.shrink(0);
 }
 
+template <class Collection, class Iterator>
+void CollectionIndexCache<Collection, Iterator>::didAppendNodes(const Collection& collection, const Vector<NodeType*>& nodes)
+{
+    ASSERT(m_listValid && m_nodeCountValid);
+
+    // The traversal position may not account for the new nodes, but the complete list does not need it.
+    m_current = collection.collectionEnd();
+
+    unsigned oldCapacity = m_cachedList.capacity();
+    m_cachedList.appendVector(nodes);
+    m_nodeCount = m_cachedList.size();
+
+    if (unsigned capacityDifference = m_cachedList.capacity() - oldCapacity)
+        reportExtraMemoryAllocatedForCollectionIndexCache(capacityDifference * sizeof(NodeType*));
+}
+
 
 }
 
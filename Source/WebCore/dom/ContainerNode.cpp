@@ -272,6 +272,11 @@ bool ContainerNode::insertBefore(Ref<Node>&& newChild, Node* refChild, Exception
 
     InspectorInstrumentation::willInsertDOMNode(document(), *this);
 
+    // Invalidate the node list and collection caches once for the whole fragment. The caches stay unregistered
+    // until something reads them again, so the per-child invalidations in childrenChanged() find nothing to extend.
+    if (targets.size() > 1)
+        invalidateNodeListAndCollectionCachesInAncestors();
+
     ChildListMutationScope mutation(*this);
     for (auto it = targets.begin(), end = targets.end(); it != end; ++it) {
         Node& child = it->get();
@@ -687,6 +692,11 @@ bool ContainerNode::appendChild(Ref<Node>&& newChild, ExceptionCode& ec)
 
     InspectorInstrumentation::willInsertDOMNode(document(), *this);
 
+    // Invalidate the node list and collection caches once for the whole fragment. The caches stay unregistered
+    // until something reads them again, so the per-child invalidations in childrenChanged() find nothing to extend.
+    if (targets.size() > 1)
+        invalidateNodeListAndCollectionCachesInAncestors();
+
     // Now actually add the child(ren)
     ChildListMutationScope mutation(*this);
     for (auto& child : targets) {
@@ -741,6 +751,13 @@ void ContainerNode::childrenChanged(const ChildChange& change)
     document().incDOMTreeVersion();
     if (change.source == ChildChangeSourceAPI && change.type != TextChanged)
         document().updateRangesAfterChildrenChanged(*this);
+
+    if (change.type == ElementInserted && !change.nextSiblingElement) {
+        Element* appendedElement = change.previousSiblingElement ? ElementTraversal::nextSibling(*change.previousSiblingElement) : ElementTraversal::firstChild(*this);
+        ASSERT(appendedElement);
+        invalidateNodeListAndCollectionCachesInAncestorsForAppendedElement(*appendedElement);
+        return;
+    }
     invalidateNodeListAndCollectionCachesInAncestors();
 }
 
@@ -2734,9 +2734,6 @@ void Document::setParsing(bool b)
 {
     m_bParsing = b;
 
-    if (m_bParsing && !m_sharedObjectPool)
-        m_sharedObjectPool = std::make_unique<DocumentSharedObjectPool>();
-
     if (!m_bParsing && view() && !view()->needsLayout())
         view()->fireLayoutRelatedMilestonesIfNeeded();
 
@@ -3501,6 +3498,12 @@ void Document::evaluateMediaQueryList()
         m_mediaQueryMatcher->styleResolverChanged();
 }
 
+void Document::evaluateMediaQueryListIfViewportChanged()
+{
+    if (m_mediaQueryMatcher)
+        m_mediaQueryMatcher->viewportMayHaveChanged();
+}
+
 void Document::optimizedStyleSheetUpdateTimerFired()
 {
     styleResolverChanged(RecalcStyleIfNeeded);
@@ -4898,20 +4901,46 @@ void Document::finishedParsing()
         InspectorInstrumentation::domContentLoadedEventFired(*f);
     }
 
-    // Schedule dropping of the DocumentSharedObjectPool. We keep it alive for a while after parsing finishes
-    // so that dynamically inserted content can also benefit from sharing optimizations.
-    // Note that we don't refresh the timer on pool access since that could lead to huge caches being kept
-    // alive indefinitely by something innocuous like JS setting .innerHTML repeatedly on a timer.
-    static const int timeToKeepSharedObjectPoolAliveAfterParsingFinishedInSeconds = 10;
-    m_sharedObjectPoolClearTimer.startOneShot(timeToKeepSharedObjectPoolAliveAfterParsingFinishedInSeconds);
+    // Schedule pruning of the DocumentSharedObjectPool now that the bulk of the markup has been parsed.
+    scheduleSharedObjectPoolPruning();
 
     // Parser should have picked up all preloads by now
     m_cachedResourceLoader->clearPreloads();
 }
 
+DocumentSharedObjectPool& Document::ensureSharedObjectPool()
+{
+    if (!m_sharedObjectPool)
+        m_sharedObjectPool = std::make_unique<DocumentSharedObjectPool>();
+    if (!m_bParsing)
+        scheduleSharedObjectPoolPruning();
+    return *m_sharedObjectPool;
+}
+
+void Document::scheduleSharedObjectPoolPruning()
+{
+    // The pool stays around for as long as the document keeps inserting markup, so that content added
+    // dynamically (e.g. repeated .innerHTML on an infinite scrolling page) shares attribute data with
+    // what is already there. Entries no element uses any more are dropped a while after the last
+    // insertion; we don't push the timer back on every access so that steady insertion still prunes.
+    static const int timeToKeepUnusedSharedObjectsAliveInSeconds = 10;
+    if (!m_sharedObjectPoolClearTimer.isActive())
+        m_sharedObjectPoolClearTimer.startOneShot(timeToKeepUnusedSharedObjectsAliveInSeconds);
+}
+
 void Document::sharedObjectPoolClearTimerFired()
 {
-    m_sharedObjectPool = nullptr;
+    if (!m_sharedObjectPool)
+        return;
+    m_sharedObjectPool->removeUnusedEntries();
+    if (m_sharedObjectPool->isEmpty()) {
+        m_sharedObjectPool = nullptr;
+        return;
+    }
+
+    // Elements still using the remaining entries can go away without inserting anything, so keep pruning
+    // until the pool is empty.
+    scheduleSharedObjectPoolPruning();
 }
 
 #if ENABLE(TELEPHONE_NUMBER_DETECTION)
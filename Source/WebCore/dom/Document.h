@@ -528,6 +528,7 @@ public:
     void scheduleOptimizedStyleSheetUpdate();
 
     void evaluateMediaQueryList();
+    void evaluateMediaQueryListIfViewportChanged();
 
     FormController& formController();
     Vector<String> formElementsState() const;
@@ -746,6 +747,7 @@ public:
     void collectionWillClearIdNameMap(const HTMLCollection&);
     bool shouldInvalidateNodeListAndCollectionCaches(const QualifiedName* attrName = nullptr) const;
     void invalidateNodeListAndCollectionCaches(const QualifiedName* attrName);
+    void invalidateNodeListAndCollectionCachesForAppendedElement(Node& parent);
 
     void attachNodeIterator(NodeIterator*);
     void detachNodeIterator(NodeIterator*);
@@ -1230,6 +1232,7 @@ public:
     void decrementActiveParserCount();
 
     DocumentSharedObjectPool* sharedObjectPool() { return m_sharedObjectPool.get(); }
+    DocumentSharedObjectPool& ensureSharedObjectPool();
 
     void didRemoveAllPendingStylesheet();
     void setNeedsNotifyRemoveAllPendingStylesheet() { m_needsNotifyRemoveAllPendingStylesheet = true; }
@@ -1704,6 +1707,7 @@ private:
     RefPtr<DOMSecurityPolicy> m_domSecurityPolicy;
 #endif
 
+    void scheduleSharedObjectPoolPruning();
     void sharedObjectPoolClearTimerFired();
     Timer m_sharedObjectPoolClearTimer;
 
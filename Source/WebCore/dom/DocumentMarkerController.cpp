@@ -46,6 +46,14 @@ inline bool DocumentMarkerController::possiblyHasMarkers(DocumentMarker::MarkerT
     return m_possiblyExistingMarkerTypes.intersects(types);
 }
 
+static void didRemoveAllMarkersFromNode(Node& node)
+{
+    // The block may have materialized line boxes only to paint this node's markers.
+    RenderObject* renderer = node.renderer();
+    if (is<RenderText>(renderer) && is<RenderBlockFlow>(renderer->parent()))
+        downcast<RenderBlockFlow>(*renderer->parent()).lineBoxesMayNoLongerBeRequired();
+}
+
 DocumentMarkerController::DocumentMarkerController(Document& document)
     : m_document(document)
 {
@@ -475,6 +483,7 @@ void DocumentMarkerController::removeMarkers(Node* node, unsigned startOffset, i
         m_markers.remove(node);
         if (m_markers.isEmpty())
             m_possiblyExistingMarkerTypes = 0;
+        didRemoveAllMarkersFromNode(*node);
     }
 
     if (docDirty && node->renderer())
@@ -606,9 +615,11 @@ void DocumentMarkerController::removeMarkersFromList(MarkerMap::iterator iterato
     }
 
     if (listCanBeRemoved) {
+        RefPtr<Node> node = iterator->key;
         m_markers.remove(iterator);
         if (m_markers.isEmpty())
             m_possiblyExistingMarkerTypes = 0;
+        didRemoveAllMarkersFromNode(*node);
     }
 }
 
@@ -59,4 +59,11 @@ Ref<ShareableElementData> DocumentSharedObjectPool::cachedShareableElementDataWi
     return *cachedData;
 }
 
+void DocumentSharedObjectPool::removeUnusedEntries()
+{
+    m_shareableElementDataCache.removeIf([] (ShareableElementDataCache::KeyValuePairType& entry) {
+        return entry.value->hasOneRef();
+    });
+}
+
 }
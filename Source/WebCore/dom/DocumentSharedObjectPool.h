@@ -41,6 +41,10 @@ class DocumentSharedObjectPool {
 public:
     Ref<ShareableElementData> cachedShareableElementDataWithAttributes(const Vector<Attribute>&);
 
+    // Entries are only referenced by the pool once every element using them is gone.
+    void removeUnusedEntries();
+    bool isEmpty() const { return m_shareableElementDataCache.isEmpty(); }
+
 private:
     typedef HashMap<unsigned, RefPtr<ShareableElementData>, AlreadyHashed> ShareableElementDataCache;
     ShareableElementDataCache m_shareableElementDataCache;
@@ -1432,13 +1432,8 @@ void Element::parserSetAttributes(const Vector<Attribute>& attributeVector)
     ASSERT(!parentNode());
     ASSERT(!m_elementData);
 
-    if (!attributeVector.isEmpty()) {
-        if (document().sharedObjectPool())
-            m_elementData = document().sharedObjectPool()->cachedShareableElementDataWithAttributes(attributeVector);
-        else
-            m_elementData = ShareableElementData::createWithAttributes(attributeVector);
-
-    }
+    if (!attributeVector.isEmpty())
+        m_elementData = document().ensureSharedObjectPool().cachedShareableElementDataWithAttributes(attributeVector);
 
     parserDidSetAttributes();
 
@@ -63,6 +63,16 @@ static size_t sizeForShareableElementDataWithAttributeCount(unsigned count)
     return sizeof(ShareableElementData) + sizeof(Attribute) * count;
 }
 
+size_t ElementData::byteSize() const
+{
+    if (is<ShareableElementData>(*this))
+        return sizeForShareableElementDataWithAttributeCount(length());
+
+    const UniqueElementData::AttributeVector& attributeVector = downcast<UniqueElementData>(*this).m_attributeVector;
+    size_t outOfLineAttributeBytes = attributeVector.capacity() > UniqueElementData::inlineAttributeCapacity ? attributeVector.capacity() * sizeof(Attribute) : 0;
+    return sizeof(UniqueElementData) + outOfLineAttributeBytes;
+}
+
 Ref<ShareableElementData> ShareableElementData::createWithAttributes(const Vector<Attribute>& attributes)
 {
     void* slot = WTF::fastMalloc(sizeForShareableElementDataWithAttributeCount(attributes.size()));
@@ -100,6 +100,9 @@ public:
     unsigned length() const;
     bool isEmpty() const { return !length(); }
 
+    // Heap footprint of this object and its attribute storage.
+    size_t byteSize() const;
+
     AttributeIteratorAccessor attributesIterator() const;
     const Attribute& attributeAt(unsigned index) const;
     const Attribute* findAttributeByName(const QualifiedName&) const;
@@ -221,7 +224,8 @@ public:
     static ptrdiff_t attributeVectorMemoryOffset() { return OBJECT_OFFSETOF(UniqueElementData, m_attributeVector); }
 
     mutable RefPtr<StyleProperties> m_presentationAttributeStyle;
-    typedef Vector<Attribute, 4> AttributeVector;
+    static const size_t inlineAttributeCapacity = 4;
+    typedef Vector<Attribute, inlineAttributeCapacity> AttributeVector;
     AttributeVector m_attributeVector;
 };
 
@@ -826,6 +826,31 @@ void Document::invalidateNodeListAndCollectionCaches(const QualifiedName* attrNa
 #endif
 }
 
+void Document::invalidateNodeListAndCollectionCachesForAppendedElement(Node& parent)
+{
+#if !ASSERT_DISABLED
+    m_inInvalidateNodeListAndCollectionCaches = true;
+#endif
+    HashSet<LiveNodeList*> lists = WTF::move(m_listsInvalidatedAtDocument);
+    m_listsInvalidatedAtDocument.clear();
+    for (auto* list : lists)
+        list->invalidateCacheForAttribute(nullptr);
+#if !ASSERT_DISABLED
+    m_inInvalidateNodeListAndCollectionCaches = false;
+#endif
+
+    // Collections cached on an inclusive ancestor of the parent are extended or invalidated by the ancestor walk.
+    // Others, like form.elements on a form that doesn't contain the new element, are invalidated here.
+    Vector<HTMLCollection*> collectionsToInvalidate;
+    for (auto* collection : m_collectionsInvalidatedAtDocument) {
+        Node& owner = collection->ownerNode();
+        if (&owner != &parent && !parent.isDescendantOf(&owner))
+            collectionsToInvalidate.append(collection);
+    }
+    for (auto* collection : collectionsToInvalidate)
+        collection->invalidateCache(*this);
+}
+
 void Node::invalidateNodeListAndCollectionCachesInAncestors(const QualifiedName* attrName, Element* attributeOwnerElement)
 {
     if (hasRareData() && (!attrName || isAttributeNode())) {
@@ -851,6 +876,29 @@ void Node::invalidateNodeListAndCollectionCachesInAncestors(const QualifiedName*
     }
 }
 
+void Node::invalidateNodeListAndCollectionCachesInAncestorsForAppendedElement(Element& appendedElement)
+{
+    ASSERT(appendedElement.isDescendantOf(this));
+
+    if (hasRareData()) {
+        if (NodeListsNodeData* lists = rareData()->nodeLists())
+            lists->clearChildNodeListCache();
+    }
+
+    if (!document().shouldInvalidateNodeListAndCollectionCaches(nullptr))
+        return;
+
+    document().invalidateNodeListAndCollectionCachesForAppendedElement(*this);
+
+    for (Node* node = this; node; node = node->parentNode()) {
+        if (!node->hasRareData())
+            continue;
+        NodeRareData* data = node->rareData();
+        if (data->nodeLists())
+            data->nodeLists()->invalidateCachesForAppendedElement(appendedElement);
+    }
+}
+
 NodeListsNodeData* Node::nodeLists()
 {
     return hasRareData() ? rareData()->nodeLists() : 0;
@@ -1803,6 +1851,18 @@ void NodeListsNodeData::invalidateCaches(const QualifiedName* attrName)
         tagCollection.value->invalidateCacheForAttribute(nullptr);
 }
 
+void NodeListsNodeData::invalidateCachesForAppendedElement(Element& element)
+{
+    for (auto& atomicName : m_atomicNameCaches)
+        atomicName.value->invalidateCacheForAttribute(nullptr);
+
+    for (auto& collection : m_cachedCollections)
+        collection.value->invalidateCacheForAppendedElement(element);
+
+    for (auto& tagCollection : m_tagCollectionCacheNS)
+        tagCollection.value->invalidateCacheForAppendedElement(element);
+}
+
 void Node::getSubresourceURLs(ListHashSet<URL>& urls) const
 {
     addSubresourceAttributeURLs(urls);
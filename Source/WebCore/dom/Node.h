@@ -508,6 +508,7 @@ public:
 #endif // ENABLE(TREE_DEBUGGING)
 
     void invalidateNodeListAndCollectionCachesInAncestors(const QualifiedName* attrName = nullptr, Element* attributeOwnerElement = nullptr);
+    void invalidateNodeListAndCollectionCachesInAncestorsForAppendedElement(Element&);
     NodeListsNodeData* nodeLists();
     void clearNodeLists();
 
@@ -196,6 +196,7 @@ public:
     }
 
     void invalidateCaches(const QualifiedName* attrName = 0);
+    void invalidateCachesForAppendedElement(Element&);
     bool isEmpty() const
     {
         return m_atomicNameCaches.isEmpty() && m_cachedCollections.isEmpty() && m_tagCollectionCacheNS.isEmpty();
@@ -55,6 +55,7 @@ public:
     void willValidateIndexCache() const { document().registerCollection(const_cast<CachedHTMLCollection<HTMLCollectionClass, traversalType>&>(*this)); }
 
     virtual void invalidateCache(Document&) override;
+    virtual void invalidateCacheForAppendedElement(Element&) override;
 
     bool elementMatches(Element&) const;
 
@@ -88,6 +89,31 @@ void CachedHTMLCollection<HTMLCollectionClass, traversalType>::invalidateCache(D
     }
 }
 
+template <typename HTMLCollectionClass, CollectionTraversalType traversalType>
+void CachedHTMLCollection<HTMLCollectionClass, traversalType>::invalidateCacheForAppendedElement(Element& element)
+{
+    // Scripts commonly read the length of a collection while appending to the end of the document.
+    // When the new subtree follows everything the collection contains and membership only depends on
+    // the element itself, extend the materialized list rather than rebuilding it on the next access.
+    ContainerNode& root = rootNode();
+    if (traversalType != CollectionTraversalType::Descendants || !collectionMatchesElementsIndependently(type())
+        || !m_indexCache.hasCompleteList() || !element.isDescendantOf(&root) || ElementTraversal::nextSkippingChildren(element, &root)) {
+        invalidateCache(document());
+        return;
+    }
+
+    HTMLCollection::invalidateCache(document());
+
+    Vector<Element*> matches;
+    if (collection().elementMatches(element))
+        matches.append(&element);
+    for (auto& descendant : elementDescendants(element)) {
+        if (collection().elementMatches(descendant))
+            matches.append(&descendant);
+    }
+    m_indexCache.didAppendNodes(collection(), matches);
+}
+
 template <typename HTMLCollectionClass, CollectionTraversalType traversalType>
 bool CachedHTMLCollection<HTMLCollectionClass, traversalType>::elementMatches(Element&) const
 {
@@ -57,6 +57,25 @@ enum CollectionType {
 };
 
 enum class CollectionTraversalType { Descendants, ChildrenOnly, CustomForwardOnly };
+
+// Whether an element belongs to a collection of this type depends on nothing but the element itself.
+inline bool collectionMatchesElementsIndependently(CollectionType type)
+{
+    switch (type) {
+    case DocImages:
+    case DocEmbeds:
+    case DocForms:
+    case DocLinks:
+    case DocAnchors:
+    case DocScripts:
+    case ByClass:
+    case ByTag:
+    case ByHTMLTag:
+        return true;
+    default:
+        return false;
+    }
+}
 template<CollectionType collectionType>
 struct CollectionTypeTraits {
     static const CollectionTraversalType traversalType = CollectionTraversalType::Descendants;
@@ -140,6 +140,11 @@ void HTMLCollection::invalidateCache(Document& document)
         invalidateNamedElementCache(document);
 }
 
+void HTMLCollection::invalidateCacheForAppendedElement(Element&)
+{
+    invalidateCache(document());
+}
+
 void HTMLCollection::invalidateNamedElementCache(Document& document) const
 {
     ASSERT(hasNamedElementCache());
@@ -82,6 +82,7 @@ public:
     ContainerNode& rootNode() const;
     void invalidateCacheForAttribute(const QualifiedName* attributeName);
     virtual void invalidateCache(Document&);
+    virtual void invalidateCacheForAppendedElement(Element&);
 
     bool hasNamedElementCache() const;
 
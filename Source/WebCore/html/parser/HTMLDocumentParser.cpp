@@ -39,6 +39,9 @@ namespace WebCore {
 
 using namespace HTMLNames;
 
+// Small next to the number of tokens the parser gets through before it yields again.
+static const unsigned maximumTokensToScanAheadPerYield = 256;
+
 HTMLDocumentParser::HTMLDocumentParser(HTMLDocument& document)
     : ScriptableDocumentParser(document)
     , m_options(document)
@@ -256,15 +259,19 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
 
     m_xssAuditor.init(document(), &m_xssAuditorDelegate);
 
+    // Tracking the source of every token copies the current input, which is only
+    // worth doing when the XSS auditor is going to look at it.
+    bool shouldFilterTokens = !isParsingFragment() && m_xssAuditor.isEnabled();
+
     while (canTakeNextToken(mode, session) && !session.needsYield) {
-        if (!isParsingFragment())
+        if (shouldFilterTokens)
             m_sourceTracker.startToken(m_input.current(), m_tokenizer);
 
         auto token = m_tokenizer.nextToken(m_input.current());
         if (!token)
             break;
 
-        if (!isParsingFragment()) {
+        if (shouldFilterTokens) {
             m_sourceTracker.endToken(m_input.current(), m_tokenizer);
 
             // We do not XSS filter innerHTML, which means we (intentionally) fail
@@ -293,6 +300,15 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
             m_preloadScanner->appendToEnd(m_input.current());
         }
         m_preloadScanner->scan(*m_preloader, *document());
+    } else if (session.needsYield && !isParsingFragment() && m_tokenizer.isInDataState() && !m_input.current().isEmpty()) {
+        // When yielding with input left over, scan a little ahead of the tokenizer so that
+        // subresources are requested while the main thread is busy elsewhere rather than
+        // when the parser gets back to them. The scan is capped so that yielding still gives
+        // the main thread back, and starts from the parser's position every time since the
+        // parser covers far more than the cap before it yields again.
+        HTMLPreloadScanner scanner(m_options, document()->url(), document()->deviceScaleFactor());
+        scanner.appendToEnd(m_input.current());
+        scanner.scan(*m_preloader, *document(), maximumTokensToScanAheadPerYield);
     }
 
     InspectorInstrumentation::didWriteHTML(cookie, m_input.current().currentLine().zeroBasedInt());
@@ -39,13 +39,23 @@ struct HTMLEntityTableEntry {
     UChar32 secondValue;
 };
 
+// A node in the trie of entity names. The children of a node are stored
+// contiguously and sorted by character, so following an edge only has to
+// look at the handful of siblings that share the current prefix.
+struct HTMLEntityTrieNode {
+    uint16_t firstChild;
+    uint16_t entryIndex;
+    uint8_t childCount;
+    LChar character;
+};
+
 class HTMLEntityTable {
 public:
-    static const HTMLEntityTableEntry* firstEntry();
-    static const HTMLEntityTableEntry* lastEntry();
+    static const HTMLEntityTrieNode* rootNode();
+    static const HTMLEntityTrieNode* childNode(const HTMLEntityTrieNode*, UChar);
 
-    static const HTMLEntityTableEntry* firstEntryStartingWith(UChar);
-    static const HTMLEntityTableEntry* lastEntryStartingWith(UChar);
+    // Returns the entry whose name is spelled by the path to this node, if any.
+    static const HTMLEntityTableEntry* entryForNode(const HTMLEntityTrieNode*);
 };
 
 }
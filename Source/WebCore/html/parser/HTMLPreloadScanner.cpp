@@ -28,12 +28,14 @@
 #include "config.h"
 #include "HTMLPreloadScanner.h"
 
+#include "DNS.h"
 #include "HTMLNames.h"
 #include "HTMLParserIdioms.h"
 #include "HTMLSrcsetParser.h"
 #include "HTMLTokenizer.h"
 #include "InputTypeNames.h"
 #include "LinkRelAttribute.h"
+#include "Settings.h"
 #include "SourceSizeList.h"
 #include <wtf/MainThread.h>
 
@@ -91,6 +93,11 @@ public:
     explicit StartTagScanner(TagId tagId, float deviceScaleFactor = 1.0)
         : m_tagId(tagId)
         , m_linkIsStyleSheet(false)
+        , m_linkIsDNSPrefetch(false)
+#if ENABLE(LINK_PREFETCH)
+        , m_linkIsPrefetch(false)
+        , m_linkIsSubresource(false)
+#endif
         , m_metaIsViewport(false)
         , m_inputIsImage(false)
         , m_deviceScaleFactor(deviceScaleFactor)
@@ -130,9 +137,28 @@ public:
 
         request->setCrossOriginModeAllowsCookies(crossOriginModeAllowsCookies());
         request->setCharset(charset());
+#if ENABLE(LINK_PREFETCH)
+        // Match the priority LinkLoader gives these, so they don't compete with parser-blocking resources.
+        if (request->resourceType() == CachedResource::LinkSubresource)
+            request->setPriority(ResourceLoadPriority::Low);
+#endif
         return request;
     }
 
+    void prefetchDNSIfNeeded(const URL& predictedBaseURL, Document& document)
+    {
+        if (m_tagId != TagId::Link || !m_linkIsDNSPrefetch || m_urlToLoad.isEmpty())
+            return;
+
+        Settings* settings = document.settings();
+        if (!settings || !settings->dnsPrefetchingEnabled())
+            return;
+
+        URL url = document.completeURL(m_urlToLoad, predictedBaseURL.isEmpty() ? document.url() : predictedBaseURL);
+        if (url.isValid() && !url.host().isEmpty())
+            prefetchDNS(url.host());
+    }
+
     static bool match(const AtomicString& name, const QualifiedName& qName)
     {
         ASSERT(isMainThread());
@@ -159,7 +185,7 @@ private:
             if (match(attributeName, hrefAttr))
                 setUrlToLoad(attributeValue);
             else if (match(attributeName, relAttr))
-                m_linkIsStyleSheet = relAttributeIsStyleSheet(attributeValue);
+                processLinkRelAttribute(attributeValue);
             else if (match(attributeName, mediaAttr))
                 m_mediaAttribute = attributeValue;
         } else if (m_tagId == TagId::Input) {
@@ -175,10 +201,15 @@ private:
         }
     }
 
-    static bool relAttributeIsStyleSheet(const String& attributeValue)
+    void processLinkRelAttribute(const String& attributeValue)
     {
         LinkRelAttribute parsedAttribute { attributeValue };
-        return parsedAttribute.isStyleSheet && !parsedAttribute.isAlternate && parsedAttribute.iconType == InvalidIcon && !parsedAttribute.isDNSPrefetch;
+        m_linkIsStyleSheet = parsedAttribute.isStyleSheet && !parsedAttribute.isAlternate && parsedAttribute.iconType == InvalidIcon && !parsedAttribute.isDNSPrefetch;
+        m_linkIsDNSPrefetch = parsedAttribute.isDNSPrefetch;
+#if ENABLE(LINK_PREFETCH)
+        m_linkIsPrefetch = parsedAttribute.isLinkPrefetch;
+        m_linkIsSubresource = parsedAttribute.isLinkSubresource;
+#endif
     }
 
     void setUrlToLoad(const String& value, bool allowReplacement = false)
@@ -209,6 +240,13 @@ private:
             return CachedResource::ImageResource;
         if (m_tagId == TagId::Link && m_linkIsStyleSheet)
             return CachedResource::CSSStyleSheet;
+#if ENABLE(LINK_PREFETCH)
+        // Like LinkLoader, a subresource hint wins over a prefetch hint when both are given.
+        if (m_tagId == TagId::Link && m_linkIsSubresource)
+            return CachedResource::LinkSubresource;
+        if (m_tagId == TagId::Link && m_linkIsPrefetch)
+            return CachedResource::LinkPrefetch;
+#endif
         ASSERT_NOT_REACHED();
         return CachedResource::RawResource;
     }
@@ -218,7 +256,7 @@ private:
         if (m_urlToLoad.isEmpty())
             return false;
 
-        if (m_tagId == TagId::Link && !m_linkIsStyleSheet)
+        if (m_tagId == TagId::Link && !m_linkIsStyleSheet && !linkIsResourceHint())
             return false;
 
         if (m_tagId == TagId::Input && !m_inputIsImage)
@@ -227,6 +265,15 @@ private:
         return true;
     }
 
+    bool linkIsResourceHint() const
+    {
+#if ENABLE(LINK_PREFETCH)
+        return m_linkIsPrefetch || m_linkIsSubresource;
+#else
+        return false;
+#endif
+    }
+
     bool crossOriginModeAllowsCookies()
     {
         return m_crossOriginMode.isNull() || equalIgnoringCase(m_crossOriginMode, "use-credentials");
@@ -239,6 +286,11 @@ private:
     String m_charset;
     String m_crossOriginMode;
     bool m_linkIsStyleSheet;
+    bool m_linkIsDNSPrefetch;
+#if ENABLE(LINK_PREFETCH)
+    bool m_linkIsPrefetch;
+    bool m_linkIsSubresource;
+#endif
     String m_mediaAttribute;
     String m_metaContent;
     bool m_metaIsViewport;
@@ -304,6 +356,7 @@ void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<Pr
 
         StartTagScanner scanner(tagId, m_deviceScaleFactor);
         scanner.processAttributes(token.attributes(), document);
+        scanner.prefetchDNSIfNeeded(m_predictedBaseElementURL, document);
         if (auto request = scanner.createPreloadRequest(m_predictedBaseElementURL))
             requests.append(WTF::move(request));
         return;
@@ -332,7 +385,7 @@ void HTMLPreloadScanner::appendToEnd(const SegmentedString& source)
     m_source.append(source);
 }
 
-void HTMLPreloadScanner::scan(HTMLResourcePreloader& preloader, Document& document)
+void HTMLPreloadScanner::scan(HTMLResourcePreloader& preloader, Document& document, unsigned maximumTokenCount)
 {
     ASSERT(isMainThread()); // HTMLTokenizer::updateStateFor only works on the main thread.
 
@@ -344,7 +397,10 @@ void HTMLPreloadScanner::scan(HTMLResourcePreloader& preloader, Document& docume
 
     PreloadRequestStream requests;
 
-    while (auto token = m_tokenizer.nextToken(m_source)) {
+    for (unsigned tokenCount = 0; tokenCount < maximumTokenCount; ++tokenCount) {
+        auto token = m_tokenizer.nextToken(m_source);
+        if (!token)
+            break;
         if (token->type() == HTMLToken::StartTag)
             m_tokenizer.updateStateFor(AtomicString(token->name()));
         m_scanner.scan(*token, requests, document);
@@ -30,6 +30,7 @@
 #include "CSSPreloadScanner.h"
 #include "HTMLTokenizer.h"
 #include "SegmentedString.h"
+#include <limits>
 
 namespace WebCore {
 
@@ -83,7 +84,8 @@ public:
     HTMLPreloadScanner(const HTMLParserOptions&, const URL& documentURL, float deviceScaleFactor = 1.0);
 
     void appendToEnd(const SegmentedString&);
-    void scan(HTMLResourcePreloader&, Document&);
+    // Stops after maximumTokenCount tokens; the next call resumes where this one stopped.
+    void scan(HTMLResourcePreloader&, Document&, unsigned maximumTokenCount = std::numeric_limits<unsigned>::max());
 
 private:
     TokenPreloadScanner m_scanner;
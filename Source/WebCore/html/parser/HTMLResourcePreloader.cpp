@@ -43,7 +43,7 @@ URL PreloadRequest::completeURL(Document& document)
 CachedResourceRequest PreloadRequest::resourceRequest(Document& document)
 {
     ASSERT(isMainThread());
-    CachedResourceRequest request(ResourceRequest(completeURL(document)));
+    CachedResourceRequest request(ResourceRequest(completeURL(document)), m_priority);
     request.setInitiator(m_initiator);
 
     // FIXME: It's possible CORS should work for other request types?
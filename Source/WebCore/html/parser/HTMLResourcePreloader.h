@@ -50,6 +50,7 @@ public:
     const String& media() const { return m_mediaAttribute; }
     void setCharset(const String& charset) { m_charset = charset.isolatedCopy(); }
     void setCrossOriginModeAllowsCookies(bool allowsCookies) { m_crossOriginModeAllowsCookies = allowsCookies; }
+    void setPriority(Optional<ResourceLoadPriority> priority) { m_priority = priority; }
     CachedResource::Type resourceType() const { return m_resourceType; }
 
 private:
@@ -62,6 +63,7 @@ private:
     CachedResource::Type m_resourceType;
     String m_mediaAttribute;
     bool m_crossOriginModeAllowsCookies;
+    Optional<ResourceLoadPriority> m_priority;
 };
 
 typedef Vector<std::unique_ptr<PreloadRequest>> PreloadRequestStream;
@@ -108,6 +108,7 @@ public:
     void beginAttribute(unsigned offset);
     void appendToAttributeName(UChar);
     void appendToAttributeValue(UChar);
+    void appendToAttributeValue(const LChar*, unsigned length);
     void endAttribute(unsigned offset);
 
     void setSelfClosing();
@@ -129,6 +130,7 @@ public:
     void appendToCharacter(LChar);
     void appendToCharacter(UChar);
     void appendToCharacter(const Vector<LChar, 32>&);
+    void appendToCharacter(const LChar*, unsigned length);
 
     // Comment.
 
@@ -342,6 +344,14 @@ inline void HTMLToken::appendToAttributeValue(UChar character)
     m_currentAttribute->value.append(character);
 }
 
+inline void HTMLToken::appendToAttributeValue(const LChar* characters, unsigned length)
+{
+    ASSERT(length);
+    ASSERT(m_type == StartTag || m_type == EndTag);
+    ASSERT(m_currentAttribute);
+    m_currentAttribute->value.append(characters, length);
+}
+
 inline void HTMLToken::appendToAttributeValue(unsigned i, StringView value)
 {
     ASSERT(!value.isEmpty());
@@ -397,6 +407,14 @@ inline void HTMLToken::appendToCharacter(const Vector<LChar, 32>& characters)
     m_data.appendVector(characters);
 }
 
+inline void HTMLToken::appendToCharacter(const LChar* characters, unsigned length)
+{
+    ASSERT(length);
+    ASSERT(m_type == Uninitialized || m_type == Character);
+    m_type = Character;
+    m_data.append(characters, length);
+}
+
 inline const HTMLToken::DataVector& HTMLToken::comment() const
 {
     ASSERT(m_type == Comment);
@@ -33,6 +33,10 @@
 #include "MarkupTokenizerInlines.h"
 #include <wtf/ASCIICType.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace WTF;
 
 namespace WebCore {
@@ -55,6 +59,57 @@ static inline bool vectorEqualsString(const Vector<LChar, 32>& vector, const cha
     return !string[size];
 }
 
+static inline bool isSpecialInRun(LChar character, LChar stopCharacter)
+{
+    return character == stopCharacter || character == '&' || character == '\r' || character == '\n' || !character;
+}
+
+#ifndef __SSE2__
+static inline uint64_t hasZeroByte(uint64_t word)
+{
+    return (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+}
+
+static inline uint64_t hasByte(uint64_t word, LChar character)
+{
+    return hasZeroByte(word ^ (0x0101010101010101ULL * character));
+}
+#endif
+
+// Returns the length of the longest prefix of |characters| that contains neither |stopCharacter|
+// nor any of '&', '\r', '\n' and '\0'. Those are the only characters that need more than
+// appending to the token in the data and quoted attribute value states.
+static size_t lengthOfPlainCharacterRun(const LChar* characters, size_t length, LChar stopCharacter)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i stop = _mm_set1_epi8(stopCharacter);
+    const __m128i ampersand = _mm_set1_epi8('&');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i null = _mm_setzero_si128();
+    for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, stop), _mm_cmpeq_epi8(chunk, ampersand)),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, carriageReturn), _mm_cmpeq_epi8(chunk, newline)), _mm_cmpeq_epi8(chunk, null)));
+        if (_mm_movemask_epi8(matches))
+            break;
+    }
+#else
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, characters + i, sizeof(word));
+        if (hasByte(word, stopCharacter) | hasByte(word, '&') | hasByte(word, '\r') | hasByte(word, '\n') | hasZeroByte(word))
+            break;
+    }
+#endif
+    for (; i < length; ++i) {
+        if (isSpecialInRun(characters[i], stopCharacter))
+            break;
+    }
+    return i;
+}
+
 inline bool HTMLTokenizer::inEndTagBufferingState() const
 {
     switch (m_state) {
@@ -92,6 +147,21 @@ inline void HTMLTokenizer::bufferCharacter(UChar character)
     m_token.appendToCharacter(character);
 }
 
+// Long stretches of text and attribute values are appended to the token in one step instead of going
+// through the state machine once per character. The run starts after the current input character and
+// the source is left on the last character of the run, so the caller can simply advance past it.
+inline unsigned HTMLTokenizer::plainCharacterRunLength(SegmentedString& source, LChar stopCharacter) const
+{
+    // The preprocessor still has to see a newline that follows a carriage return, and moving off
+    // a newline has to go through advanceAndUpdateLineNumber().
+    if (m_preprocessor.skipNextNewLine() || source.currentChar() == '\n')
+        return 0;
+    unsigned length = source.numberOfUpcoming8BitCharacters();
+    if (!length)
+        return 0;
+    return lengthOfPlainCharacterRun(source.upcoming8BitCharacters(), length, stopCharacter);
+}
+
 inline bool HTMLTokenizer::emitAndResumeInDataState(SegmentedString& source)
 {
     saveEndTagNameIfNeeded();
@@ -221,6 +291,10 @@ bool HTMLTokenizer::processToken(SegmentedString& source)
         if (character == kEndOfFileMarker)
             return emitEndOfFile(source);
         bufferCharacter(character);
+        if (unsigned runLength = plainCharacterRunLength(source, '<')) {
+            m_token.appendToCharacter(source.upcoming8BitCharacters(), runLength);
+            source.advancePast8BitNonNewlines(runLength);
+        }
         ADVANCE_TO(DataState);
     END_STATE()
 
@@ -808,6 +882,10 @@ bool HTMLTokenizer::processToken(SegmentedString& source)
             RECONSUME_IN(DataState);
         }
         m_token.appendToAttributeValue(character);
+        if (unsigned runLength = plainCharacterRunLength(source, '"')) {
+            m_token.appendToAttributeValue(source.upcoming8BitCharacters(), runLength);
+            source.advancePast8BitNonNewlines(runLength);
+        }
         ADVANCE_TO(AttributeValueDoubleQuotedState);
     END_STATE()
 
@@ -826,6 +904,10 @@ bool HTMLTokenizer::processToken(SegmentedString& source)
             RECONSUME_IN(DataState);
         }
         m_token.appendToAttributeValue(character);
+        if (unsigned runLength = plainCharacterRunLength(source, '\'')) {
+            m_token.appendToAttributeValue(source.upcoming8BitCharacters(), runLength);
+            source.advancePast8BitNonNewlines(runLength);
+        }
         ADVANCE_TO(AttributeValueSingleQuotedState);
     END_STATE()
 
@@ -160,6 +160,7 @@ private:
 
     void bufferASCIICharacter(UChar);
     void bufferCharacter(UChar);
+    unsigned plainCharacterRunLength(SegmentedString&, LChar stopCharacter) const;
 
     bool emitAndResumeInDataState(SegmentedString&);
     bool emitAndReconsumeInDataState();
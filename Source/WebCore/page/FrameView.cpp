@@ -1230,6 +1230,9 @@ void FrameView::layout(bool allowSubtree)
     // so save the layout phase now and restore it on exit.
     TemporaryChange<LayoutPhase> layoutPhaseRestorer(m_layoutPhase, InPreLayout);
 
+    if (RenderView* renderView = this->renderView())
+        renderView->invalidateAbsoluteOffsetCache();
+
     // Every scroll that happens during layout is programmatic.
     TemporaryChange<bool> changeInProgrammaticScroll(m_inProgrammaticScroll, true);
 
@@ -1293,7 +1296,7 @@ void FrameView::layout(bool allowSubtree)
             // FIXME: This instrumentation event is not strictly accurate since cached media query results do not persist across StyleResolver rebuilds.
             InspectorInstrumentation::mediaQueryResultChanged(document);
         } else
-            document.evaluateMediaQueryList();
+            document.evaluateMediaQueryListIfViewportChanged();
 
         // If there is any pagination to apply, it will affect the RenderView's style, so we should
         // take care of that now.
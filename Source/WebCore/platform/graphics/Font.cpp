@@ -36,6 +36,7 @@
 #include "FontCache.h"
 #include "FontCascade.h"
 #include "OpenTypeMathData.h"
+#include "WidthCache.h"
 #include <wtf/MathExtras.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/text/AtomicStringHash.h>
@@ -387,6 +388,23 @@ bool Font::applyTransforms(GlyphBufferGlyph* glyphs, GlyphBufferAdvance* advance
 #endif
 }
 
+WidthCache& Font::sharedWidthCache(TypesettingFeatures typesettingFeatures) const
+{
+    ASSERT(typesettingFeatures <= (Kerning | Ligatures));
+    auto& widthCache = m_sharedWidthCaches[typesettingFeatures];
+    if (!widthCache)
+        widthCache = std::make_unique<WidthCache>();
+    return *widthCache;
+}
+
+void Font::clearSharedWidthCaches() const
+{
+    for (auto& widthCache : m_sharedWidthCaches) {
+        if (widthCache)
+            widthCache->clear();
+    }
+}
+
 class CharacterFallbackMapKey {
 public:
     CharacterFallbackMapKey()
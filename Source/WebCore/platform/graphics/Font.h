@@ -59,6 +59,7 @@
 namespace WebCore {
 
 class GlyphPage;
+class WidthCache;
 class FontDescription;
 class SharedBuffer;
 struct GlyphData;
@@ -203,6 +204,10 @@ public:
 
     bool applyTransforms(GlyphBufferGlyph*, GlyphBufferAdvance*, size_t glyphCount, TypesettingFeatures) const;
 
+    // Widths of words that were measured with this font alone. Shared by all font cascades that use this font as their primary font.
+    WidthCache& sharedWidthCache(TypesettingFeatures) const;
+    void clearSharedWidthCaches() const;
+
 #if PLATFORM(COCOA) || PLATFORM(WIN)
     bool isSystemFont() const { return m_isSystemFont; }
 #endif
@@ -287,6 +292,8 @@ private:
 
     mutable std::unique_ptr<DerivedFontData> m_derivedFontData;
 
+    mutable std::unique_ptr<WidthCache> m_sharedWidthCaches[(Kerning | Ligatures) + 1];
+
 #if USE(CG) || USE(CAIRO)
     float m_syntheticBoldOffset;
 #endif
@@ -471,6 +471,12 @@ void FontCache::purgeInactiveFontData(unsigned purgeCount)
     platformPurgeInactiveFontData();
 }
 
+void FontCache::clearSharedWidthCaches()
+{
+    for (auto& font : cachedFonts().values())
+        font->clearSharedWidthCaches();
+}
+
 size_t FontCache::fontCount()
 {
     return cachedFonts().size();
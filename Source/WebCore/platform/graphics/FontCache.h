@@ -205,6 +205,7 @@ public:
     WEBCORE_EXPORT size_t fontCount();
     WEBCORE_EXPORT size_t inactiveFontCount();
     WEBCORE_EXPORT void purgeInactiveFontData(unsigned count = UINT_MAX);
+    void clearSharedWidthCaches();
     void platformPurgeInactiveFontData();
 
 #if PLATFORM(WIN)
@@ -228,6 +228,7 @@ void clearWidthCaches()
 {
     for (auto& value : fontCascadeCache().values())
         value->fonts.get().widthCache().clear();
+    FontCache::singleton().clearSharedWidthCaches();
 }
 
 static FontCascadeCacheKey makeFontCascadeCacheKey(const FontCascadeDescription& description, FontSelector* fontSelector)
@@ -355,7 +356,8 @@ float FontCascade::width(const TextRun& run, HashSet<const Font*>* fallbackFonts
 
     bool hasKerningOrLigatures = typesettingFeatures() & (Kerning | Ligatures);
     bool hasWordSpacingOrLetterSpacing = wordSpacing() || letterSpacing();
-    float* cacheEntry = m_fonts->widthCache().add(run, std::numeric_limits<float>::quiet_NaN(), hasKerningOrLigatures, hasWordSpacingOrLetterSpacing, glyphOverflow);
+    WidthCache& widthCache = m_useBackslashAsYenSymbol ? m_fonts->widthCache() : m_fonts->widthCacheForMeasuring(m_fontDescription, typesettingFeatures());
+    float* cacheEntry = widthCache.add(run, std::numeric_limits<float>::quiet_NaN(), hasKerningOrLigatures, hasWordSpacingOrLetterSpacing, glyphOverflow);
     if (cacheEntry && !std::isnan(*cacheEntry))
         return *cacheEntry;
 
@@ -199,6 +199,22 @@ const FontRanges& FontCascadeFonts::realizeFallbackRangesAt(const FontCascadeDes
     return fontRanges;
 }
 
+WidthCache& FontCascadeFonts::widthCacheForMeasuring(const FontCascadeDescription& description, TypesettingFeatures typesettingFeatures)
+{
+    // Only widths measured without any fallback font are cached. When the primary font is the only font in the
+    // first family, every character it has a glyph for is looked up in the primary font by any cascade, so such
+    // widths do not depend on the rest of the cascade and can be shared by all cascades with this primary font.
+    const Font& primaryFont = this->primaryFont(description);
+    if (primaryFont.isCustomFont() || primaryFont.isLoading() || primaryFont.isSVGFont())
+        return m_widthCache;
+    if (description.smallCaps() != FontSmallCapsOff || description.orientation() != Horizontal || description.featureSettings().size())
+        return m_widthCache;
+    auto& primaryRanges = realizeFallbackRangesAt(description, 0);
+    if (primaryRanges.size() != 1 || &primaryRanges.fontForFirstRange() != &primaryFont)
+        return m_widthCache;
+    return primaryFont.sharedWidthCache(typesettingFeatures);
+}
+
 static inline bool isInRange(UChar32 character, UChar32 lowerBound, UChar32 upperBound)
 {
     return character >= lowerBound && character <= upperBound;
@@ -66,6 +66,7 @@ public:
 
     WidthCache& widthCache() { return m_widthCache; }
     const WidthCache& widthCache() const { return m_widthCache; }
+    WidthCache& widthCacheForMeasuring(const FontCascadeDescription&, TypesettingFeatures);
 
     const Font& primaryFont(const FontCascadeDescription&);
     WEBCORE_EXPORT const FontRanges& realizeFallbackRangesAt(const FontCascadeDescription&, unsigned fallbackIndex);
@@ -38,6 +38,7 @@ namespace WebCore {
 struct GlyphOverflow;
 
 class WidthCache {
+    WTF_MAKE_FAST_ALLOCATED;
 private:
     // Used to optimize small strings as hash table keys. Avoids malloc'ing an out-of-line StringImpl.
     class SmallStringKey {
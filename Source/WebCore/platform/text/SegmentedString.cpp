@@ -127,11 +127,39 @@ void SegmentedString::append(const SegmentedSubstring& s)
         m_numberOfCharactersConsumedPriorToCurrentString += m_currentString.numberOfCharactersConsumed();
         m_currentString = s;
         updateAdvanceFunctionPointers();
-    } else
+    } else if (!m_substrings.isEmpty() && canCoalesce(m_substrings.last(), s))
+        m_substrings.last() = coalesce(m_substrings.last(), s);
+    else
         m_substrings.append(s);
     m_empty = false;
 }
 
+// Input that arrives in many small network packets would otherwise leave us with many tiny
+// substrings, each boundary forcing the slow advance path. Merge small pending substrings
+// as long as that keeps the copying bounded and does not widen 8-bit data.
+static const int maximumCoalescedSubstringLength = 1024;
+
+bool SegmentedString::canCoalesce(const SegmentedSubstring& first, const SegmentedSubstring& second)
+{
+    if (first.m_length + second.m_length > maximumCoalescedSubstringLength)
+        return false;
+    if (first.numberOfCharactersConsumed() || second.numberOfCharactersConsumed())
+        return false;
+    return first.is8Bit() == second.is8Bit() && first.excludeLineNumbers() == second.excludeLineNumbers();
+}
+
+SegmentedSubstring SegmentedString::coalesce(const SegmentedSubstring& first, const SegmentedSubstring& second)
+{
+    StringBuilder builder;
+    builder.reserveCapacity(first.m_length + second.m_length);
+    first.appendTo(builder);
+    second.appendTo(builder);
+    SegmentedSubstring result(builder.toString());
+    if (first.excludeLineNumbers())
+        result.setExcludeLineNumbers();
+    return result;
+}
+
 void SegmentedString::pushBack(const SegmentedSubstring& s)
 {
     ASSERT(!m_pushedChar1);
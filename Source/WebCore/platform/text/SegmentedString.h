@@ -56,7 +56,7 @@ public:
 
     void clear() { m_length = 0; m_data.string16Ptr = 0; m_is8Bit = false;}
     
-    bool is8Bit() { return m_is8Bit; }
+    bool is8Bit() const { return m_is8Bit; }
     
     bool excludeLineNumbers() const { return !m_doNotExcludeLineNumbers; }
     bool doNotExcludeLineNumbers() const { return m_doNotExcludeLineNumbers; }
@@ -265,6 +265,32 @@ public:
         advanceAndUpdateLineNumberSlowCase();
     }
 
+    // The 8-bit characters following the current one that can be consumed in bulk with
+    // advancePast8BitNonNewlines(). Always leaves the last character of the current substring
+    // for the regular advance functions, and is empty when the 8-bit fast path is not in use.
+    unsigned numberOfUpcoming8BitCharacters() const
+    {
+        if (!(m_fastPathFlags & Use8BitAdvance))
+            return 0;
+        ASSERT(m_currentString.m_length > 1);
+        return m_currentString.m_length - 2;
+    }
+
+    const LChar* upcoming8BitCharacters() const
+    {
+        ASSERT(m_fastPathFlags & Use8BitAdvance);
+        return m_currentString.m_data.string8Ptr + 1;
+    }
+
+    void advancePast8BitNonNewlines(unsigned count)
+    {
+        ASSERT(count <= numberOfUpcoming8BitCharacters());
+        ASSERT(!memchr(m_currentString.m_data.string8Ptr, '\n', count));
+        m_currentString.m_length -= count;
+        m_currentString.m_data.string8Ptr += count;
+        m_currentChar = *m_currentString.m_data.string8Ptr;
+    }
+
     int numberOfCharactersConsumed() const
     {
         int numberOfPushedCharacters = 0;
@@ -297,6 +323,9 @@ private:
     void append(const SegmentedSubstring&);
     void pushBack(const SegmentedSubstring&);
 
+    static bool canCoalesce(const SegmentedSubstring&, const SegmentedSubstring&);
+    static SegmentedSubstring coalesce(const SegmentedSubstring&, const SegmentedSubstring&);
+
     void advance8();
     void advance16();
     void advanceAndUpdateLineNumber8();
@@ -29,6 +29,10 @@
 
 #include <wtf/text/ASCIIFastPath.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace WebCore {
 
 template<size_t size> struct UCharByteFiller;
@@ -75,6 +79,56 @@ inline void copyASCIIMachineWord(UChar* destination, const uint8_t* source)
     UCharByteFiller<sizeof(WTF::MachineWord)>::copy(destination, source);
 }
 
+#ifdef __SSE2__
+inline void copyASCIIVector(LChar* destination, __m128i chunk)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), chunk);
+}
+
+inline void copyASCIIVector(UChar* destination, __m128i chunk)
+{
+    const __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi8(chunk, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + sizeof(__m128i) / sizeof(UChar)), _mm_unpackhi_epi8(chunk, zero));
+}
+#endif
+
+// Copies the ASCII bytes at the start of [source, end) to destination, widening them if needed,
+// and returns how many were copied. Stops at the first non-ASCII byte.
+template<typename CharacterType>
+inline size_t copyASCIIRun(CharacterType* destination, const uint8_t* source, const uint8_t* end)
+{
+    const uint8_t* start = source;
+#ifdef __SSE2__
+    // Unaligned 16-byte loads are cheap, so there is no need to align the source first.
+    while (end - source >= static_cast<ptrdiff_t>(sizeof(__m128i))) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        if (_mm_movemask_epi8(chunk))
+            break;
+        copyASCIIVector(destination, chunk);
+        source += sizeof(__m128i);
+        destination += sizeof(__m128i);
+    }
+#else
+    const uint8_t* alignedEnd = alignToMachineWord(end);
+    while (source < alignedEnd && !isAlignedToMachineWord(source) && isASCII(*source))
+        *destination++ = *source++;
+    if (isAlignedToMachineWord(source)) {
+        while (source < alignedEnd) {
+            MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
+            if (!isAllASCII<LChar>(chunk))
+                break;
+            copyASCIIMachineWord(destination, source);
+            source += sizeof(MachineWord);
+            destination += sizeof(MachineWord);
+        }
+    }
+#endif
+    while (source < end && isASCII(*source))
+        *destination++ = *source++;
+    return source - start;
+}
+
 } // namespace WebCore
 
 #endif // TextCodecASCIIFastPath_h
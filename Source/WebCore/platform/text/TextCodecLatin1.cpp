@@ -126,42 +126,20 @@ String TextCodecLatin1::decode(const char* bytes, size_t length, bool, bool, boo
 
     const uint8_t* source = reinterpret_cast<const uint8_t*>(bytes);
     const uint8_t* end = reinterpret_cast<const uint8_t*>(bytes + length);
-    const uint8_t* alignedEnd = alignToMachineWord(end);
     LChar* destination = characters;
 
     while (source < end) {
         if (isASCII(*source)) {
             // Fast path for ASCII. Most Latin-1 text will be ASCII.
-            if (isAlignedToMachineWord(source)) {
-                while (source < alignedEnd) {
-                    MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
-
-                    if (!isAllASCII<LChar>(chunk))
-                        goto useLookupTable;
-
-                    copyASCIIMachineWord(destination, source);
-                    source += sizeof(MachineWord);
-                    destination += sizeof(MachineWord);
-                }
-
-                if (source == end)
-                    break;
-
-                // *source may not be ASCII anymore if source moves inside the loop of the fast code path
-                if (!isASCII(*source))
-                    goto useLookupTable;
-            }
-            *destination = *source;
-        } else {
-useLookupTable:
-            if (table[*source] > 0xff)
-                goto upConvertTo16Bit;
-
-            *destination = table[*source];
+            size_t asciiLength = copyASCIIRun(destination, source, end);
+            source += asciiLength;
+            destination += asciiLength;
+            continue;
         }
+        if (table[*source] > 0xff)
+            goto upConvertTo16Bit;
 
-        ++source;
-        ++destination;
+        *destination++ = table[*source++];
     }
 
     return result;
@@ -187,33 +165,12 @@ upConvertTo16Bit:
     while (source < end) {
         if (isASCII(*source)) {
             // Fast path for ASCII. Most Latin-1 text will be ASCII.
-            if (isAlignedToMachineWord(source)) {
-                while (source < alignedEnd) {
-                    MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
-                    
-                    if (!isAllASCII<LChar>(chunk))
-                        goto useLookupTable16;
-                    
-                    copyASCIIMachineWord(destination16, source);
-                    source += sizeof(MachineWord);
-                    destination16 += sizeof(MachineWord);
-                }
-                
-                if (source == end)
-                    break;
-
-                // *source may not be ASCII anymore if source moves inside the loop of the fast code path
-                if (!isASCII(*source))
-                    goto useLookupTable16;
-            }
-            *destination16 = *source;
-        } else {
-useLookupTable16:
-            *destination16 = table[*source];
+            size_t asciiLength = copyASCIIRun(destination16, source, end);
+            source += asciiLength;
+            destination16 += asciiLength;
+            continue;
         }
-        
-        ++source;
-        ++destination16;
+        *destination16++ = table[*source++];
     }
     
     return result16;
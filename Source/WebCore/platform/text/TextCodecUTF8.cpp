@@ -269,7 +269,6 @@ String TextCodecUTF8::decode(const char* bytes, size_t length, bool flush, bool
 
     const uint8_t* source = reinterpret_cast<const uint8_t*>(bytes);
     const uint8_t* end = source + length;
-    const uint8_t* alignedEnd = alignToMachineWord(end);
     LChar* destination = buffer.characters();
 
     do {
@@ -292,21 +291,15 @@ String TextCodecUTF8::decode(const char* bytes, size_t length, bool flush, bool
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
-                if (isAlignedToMachineWord(source)) {
-                    while (source < alignedEnd) {
-                        MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
-                        if (!isAllASCII<LChar>(chunk))
-                            break;
-                        copyASCIIMachineWord(destination, source);
-                        source += sizeof(MachineWord);
-                        destination += sizeof(MachineWord);
-                    }
-                    if (source == end)
-                        break;
-                    if (!isASCII(*source))
-                        continue;
-                }
-                *destination++ = *source++;
+                size_t asciiLength = copyASCIIRun(destination, source, end);
+                source += asciiLength;
+                destination += asciiLength;
+                continue;
+            }
+            // Fast path for the two-byte sequences that encode U+0080 to U+00FF, which keep the result 8-bit.
+            if ((*source & 0xFE) == 0xC2 && end - source >= 2 && (source[1] & 0xC0) == 0x80) {
+                *destination++ = ((source[0] & 0x1F) << 6) | (source[1] & 0x3F);
+                source += 2;
                 continue;
             }
             int count = nonASCIISequenceLength(*source);
@@ -369,21 +362,9 @@ upConvertTo16Bit:
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
-                if (isAlignedToMachineWord(source)) {
-                    while (source < alignedEnd) {
-                        MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
-                        if (!isAllASCII<LChar>(chunk))
-                            break;
-                        copyASCIIMachineWord(destination16, source);
-                        source += sizeof(MachineWord);
-                        destination16 += sizeof(MachineWord);
-                    }
-                    if (source == end)
-                        break;
-                    if (!isASCII(*source))
-                        continue;
-                }
-                *destination16++ = *source++;
+                size_t asciiLength = copyASCIIRun(destination16, source, end);
+                source += asciiLength;
+                destination16 += asciiLength;
                 continue;
             }
             int count = nonASCIISequenceLength(*source);
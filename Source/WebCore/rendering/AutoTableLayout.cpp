@@ -34,6 +34,7 @@ AutoTableLayout::AutoTableLayout(RenderTable* table)
     : TableLayout(table)
     , m_hasPercent(false)
     , m_effectiveLogicalWidthDirty(true)
+    , m_needsFullRecalc(true)
 {
 }
 
@@ -41,7 +42,7 @@ AutoTableLayout::~AutoTableLayout()
 {
 }
 
-void AutoTableLayout::recalcColumn(unsigned effCol)
+void AutoTableLayout::recalcColumn(unsigned effCol, bool collectSpanCells)
 {
     Layout& columnLayout = m_layoutStruct[effCol];
 
@@ -109,6 +110,7 @@ void AutoTableLayout::recalcColumn(unsigned effCol)
                         break;
                     case Percent:
                         m_hasPercent = true;
+                        columnLayout.hasPercentCell = true;
                         if (cellLogicalWidth.isPositive() && (!columnLayout.logicalWidth.isPercent() || cellLogicalWidth.percent() > columnLayout.logicalWidth.percent()))
                             columnLayout.logicalWidth = cellLogicalWidth;
                         break;
@@ -121,7 +123,7 @@ void AutoTableLayout::recalcColumn(unsigned effCol)
                     default:
                         break;
                     }
-                } else if (!effCol || section.primaryCellAt(i, effCol - 1) != cell) {
+                } else if (collectSpanCells && (!effCol || section.primaryCellAt(i, effCol - 1) != cell)) {
                     // This spanning cell originates in this column. Insert the cell into spanning cells list.
                     insertSpanCell(cell);
                 }
@@ -140,16 +142,9 @@ void AutoTableLayout::recalcColumn(unsigned effCol)
     columnLayout.maxLogicalWidth = std::max(columnLayout.maxLogicalWidth, columnLayout.minLogicalWidth);
 }
 
-void AutoTableLayout::fullRecalc()
+void AutoTableLayout::computeColumnElementLayouts(ColumnLayouts& columnLayouts) const
 {
-    m_hasPercent = false;
-    m_effectiveLogicalWidthDirty = true;
-
-    unsigned nEffCols = m_table->numEffCols();
-    m_layoutStruct.resize(nEffCols);
-    m_layoutStruct.fill(Layout());
-    m_spanCells.fill(0);
-
+    unsigned nEffCols = columnLayouts.size();
     Length groupLogicalWidth;
     unsigned currentColumn = 0;
     for (RenderTableCol* column = m_table->firstColumn(); column; column = column->nextColumn()) {
@@ -164,9 +159,9 @@ void AutoTableLayout::fullRecalc()
             unsigned effCol = m_table->colToEffCol(currentColumn);
             unsigned span = column->span();
             if (!colLogicalWidth.isAuto() && span == 1 && effCol < nEffCols && m_table->spanOfEffCol(effCol) == 1) {
-                m_layoutStruct[effCol].logicalWidth = colLogicalWidth;
-                if (colLogicalWidth.isFixed() && m_layoutStruct[effCol].maxLogicalWidth < colLogicalWidth.value())
-                    m_layoutStruct[effCol].maxLogicalWidth = colLogicalWidth.value();
+                columnLayouts[effCol].logicalWidth = colLogicalWidth;
+                if (colLogicalWidth.isFixed() && columnLayouts[effCol].maxLogicalWidth < colLogicalWidth.value())
+                    columnLayouts[effCol].maxLogicalWidth = colLogicalWidth.value();
             }
             currentColumn += span;
         }
@@ -175,9 +170,87 @@ void AutoTableLayout::fullRecalc()
         if (column->isTableColumn() && !column->nextSibling())
             groupLogicalWidth = Length();
     }
+}
+
+void AutoTableLayout::fullRecalc()
+{
+    m_hasPercent = false;
+    m_effectiveLogicalWidthDirty = true;
+    m_needsFullRecalc = false;
+
+    unsigned nEffCols = m_table->numEffCols();
+    m_columnElementLayouts.resize(nEffCols);
+    m_columnElementLayouts.fill(Layout());
+    m_spanCells.fill(0);
+
+    computeColumnElementLayouts(m_columnElementLayouts);
+    m_layoutStruct = m_columnElementLayouts;
 
     for (unsigned i = 0; i < nEffCols; i++)
         recalcColumn(i);
+
+    m_cellLayouts = m_layoutStruct;
+}
+
+// Recomputes only the columns that have a cell with dirty preferred widths, or whose <col> width changed.
+// Returns false if that is not enough and a full recalc is needed instead.
+bool AutoTableLayout::recalcDirtyColumns()
+{
+    unsigned nEffCols = m_table->numEffCols();
+    if (m_needsFullRecalc || m_layoutStruct.size() != nEffCols)
+        return false;
+
+    ColumnLayouts columnElementLayouts(nEffCols);
+    computeColumnElementLayouts(columnElementLayouts);
+
+    Vector<bool> columnIsDirty(nEffCols, false);
+    for (unsigned i = 0; i < nEffCols; ++i) {
+        if (columnElementLayouts[i].logicalWidth != m_columnElementLayouts[i].logicalWidth || columnElementLayouts[i].maxLogicalWidth != m_columnElementLayouts[i].maxLogicalWidth)
+            columnIsDirty[i] = true;
+    }
+
+    for (RenderObject* child = m_table->firstChild(); child; child = child->nextSibling()) {
+        if (is<RenderTableCol>(*child)) {
+            // See recalcColumn() for why the dirty bits are cleared even though we never read RenderTableCol's preferred widths.
+            downcast<RenderTableCol>(*child).clearPreferredLogicalWidthsDirtyBits();
+            continue;
+        }
+        if (!is<RenderTableSection>(*child))
+            continue;
+        RenderTableSection& section = downcast<RenderTableSection>(*child);
+        unsigned numRows = section.numRows();
+        for (unsigned row = 0; row < numRows; ++row) {
+            for (unsigned effCol = 0; effCol < nEffCols; ++effCol) {
+                RenderTableSection::CellStruct& current = section.cellAt(row, effCol);
+                RenderTableCell* cell = current.primaryCell();
+                if (current.inColSpan || !cell || !cell->preferredLogicalWidthsDirty())
+                    continue;
+                // Spanning cells feed into several columns through calcEffectiveLogicalWidth, keep it simple.
+                if (cell->colSpan() != 1)
+                    return false;
+                columnIsDirty[effCol] = true;
+            }
+        }
+    }
+
+    m_columnElementLayouts = WTF::move(columnElementLayouts);
+
+    // calcEffectiveLogicalWidth() also writes to the base fields of the columns covered by spanning cells.
+    m_layoutStruct = m_cellLayouts;
+    m_effectiveLogicalWidthDirty = true;
+
+    m_hasPercent = false;
+    for (unsigned i = 0; i < nEffCols; ++i) {
+        if (columnIsDirty[i]) {
+            m_layoutStruct[i] = m_columnElementLayouts[i];
+            // The spanning cells did not change, so they are already in m_spanCells.
+            recalcColumn(i, false);
+        }
+        m_hasPercent |= m_layoutStruct[i].hasPercentCell;
+    }
+
+    m_cellLayouts = m_layoutStruct;
+    return true;
 }
 
 // FIXME: This needs to be adapted for vertical writing modes.
@@ -212,7 +285,8 @@ static bool shouldScaleColumns(RenderTable* table)
 
 void AutoTableLayout::computeIntrinsicLogicalWidths(LayoutUnit& minWidth, LayoutUnit& maxWidth)
 {
-    fullRecalc();
+    if (!recalcDirtyColumns())
+        fullRecalc();
 
     int spanMaxLogicalWidth = calcEffectiveLogicalWidth();
     minWidth = 0;
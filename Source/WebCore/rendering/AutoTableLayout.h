@@ -39,10 +39,16 @@ public:
     virtual void computeIntrinsicLogicalWidths(LayoutUnit& minWidth, LayoutUnit& maxWidth) override;
     virtual void applyPreferredLogicalWidthQuirks(LayoutUnit& minWidth, LayoutUnit& maxWidth) const override;
     virtual void layout() override;
+    virtual void setNeedsFullRecalc() override { m_needsFullRecalc = true; }
 
 private:
+    struct Layout;
+    typedef Vector<Layout, 4> ColumnLayouts;
+
     void fullRecalc();
-    void recalcColumn(unsigned effCol);
+    bool recalcDirtyColumns();
+    void recalcColumn(unsigned effCol, bool collectSpanCells = true);
+    void computeColumnElementLayouts(ColumnLayouts&) const;
 
     int calcEffectiveLogicalWidth();
 
@@ -56,6 +62,7 @@ private:
             , effectiveMaxLogicalWidth(0)
             , computedLogicalWidth(0)
             , emptyCellsOnly(true)
+            , hasPercentCell(false)
         {
         }
 
@@ -67,12 +74,19 @@ private:
         int effectiveMaxLogicalWidth;
         int computedLogicalWidth;
         bool emptyCellsOnly;
+        bool hasPercentCell;
     };
 
-    Vector<Layout, 4> m_layoutStruct;
+    ColumnLayouts m_layoutStruct;
+    // What m_layoutStruct looked like before the cells were taken into account, i.e. the widths coming from <col> elements.
+    ColumnLayouts m_columnElementLayouts;
+    // What m_layoutStruct looked like after the cells were taken into account, but before calcEffectiveLogicalWidth()
+    // folded the spanning cells in, so that recalculating a subset of the columns starts from the same state as a full recalc.
+    ColumnLayouts m_cellLayouts;
     Vector<RenderTableCell*, 4> m_spanCells;
     bool m_hasPercent : 1;
     mutable bool m_effectiveLogicalWidthDirty : 1;
+    bool m_needsFullRecalc : 1;
 };
 
 } // namespace WebCore
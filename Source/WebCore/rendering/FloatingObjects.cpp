@@ -255,6 +255,9 @@ FloatingObjects::FloatingObjects(const RenderBlockFlow& renderer)
     : m_leftObjectsCount(0)
     , m_rightObjectsCount(0)
     , m_horizontalWritingMode(renderer.isHorizontalWritingMode())
+    , m_placedLeftFloatsLogicalBottom(LayoutUnit::min())
+    , m_placedRightFloatsLogicalBottom(LayoutUnit::min())
+    , m_placedFloatsLogicalBottomIsStale(false)
     , m_renderer(renderer)
 {
 }
@@ -275,9 +278,16 @@ void FloatingObjects::clearLineBoxTreePointers()
 void FloatingObjects::clear()
 {
     m_set.clear();
-    m_placedFloatsTree = nullptr;
+    // Keep the tree around: blocks clear their floats at the start of every layout and then place them again,
+    // and an existing tree gets those updated incrementally instead of being rebuilt on the next query.
+    if (m_placedFloatsTree)
+        m_placedFloatsTree->clear();
     m_leftObjectsCount = 0;
     m_rightObjectsCount = 0;
+    m_placedLeftFloatsLogicalBottom = LayoutUnit::min();
+    m_placedRightFloatsLogicalBottom = LayoutUnit::min();
+    m_placedFloatsLogicalBottomIsStale = false;
+    invalidateCachedLineOffsets();
 }
 
 void FloatingObjects::moveAllToFloatInfoMap(RendererToFloatInfoMap& map)
@@ -322,8 +332,13 @@ void FloatingObjects::addPlacedObject(FloatingObject* floatingObject)
     ASSERT(!floatingObject->isInPlacedTree());
 
     floatingObject->setIsPlaced(true);
+    FloatingObjectInterval interval = intervalForFloatingObject(floatingObject);
     if (m_placedFloatsTree)
-        m_placedFloatsTree->add(intervalForFloatingObject(floatingObject));
+        m_placedFloatsTree->add(interval);
+
+    LayoutUnit& placedFloatsLogicalBottom = floatingObject->type() == FloatingObject::FloatLeft ? m_placedLeftFloatsLogicalBottom : m_placedRightFloatsLogicalBottom;
+    placedFloatsLogicalBottom = std::max(placedFloatsLogicalBottom, interval.high());
+    invalidateCachedLineOffsets();
 
 #ifndef NDEBUG
     floatingObject->setIsInPlacedTree(true);
@@ -334,11 +349,17 @@ void FloatingObjects::removePlacedObject(FloatingObject* floatingObject)
 {
     ASSERT(floatingObject->isPlaced() && floatingObject->isInPlacedTree());
 
+    FloatingObjectInterval interval = intervalForFloatingObject(floatingObject);
     if (m_placedFloatsTree) {
-        bool removed = m_placedFloatsTree->remove(intervalForFloatingObject(floatingObject));
+        bool removed = m_placedFloatsTree->remove(interval);
         ASSERT_UNUSED(removed, removed);
     }
 
+    LayoutUnit placedFloatsLogicalBottom = floatingObject->type() == FloatingObject::FloatLeft ? m_placedLeftFloatsLogicalBottom : m_placedRightFloatsLogicalBottom;
+    if (interval.high() >= placedFloatsLogicalBottom)
+        m_placedFloatsLogicalBottomIsStale = true;
+    invalidateCachedLineOffsets();
+
     floatingObject->setIsPlaced(false);
 #ifndef NDEBUG
     floatingObject->setIsInPlacedTree(false);
@@ -388,8 +409,37 @@ inline const FloatingObjectTree* FloatingObjects::placedFloatsTree()
     return m_placedFloatsTree.get();
 }
 
+LayoutUnit FloatingObjects::placedFloatsLogicalBottom(FloatingObject::Type type)
+{
+    if (m_placedFloatsLogicalBottomIsStale) {
+        m_placedLeftFloatsLogicalBottom = LayoutUnit::min();
+        m_placedRightFloatsLogicalBottom = LayoutUnit::min();
+        for (auto it = m_set.begin(), end = m_set.end(); it != end; ++it) {
+            FloatingObject* floatingObject = it->get();
+            if (!floatingObject->isPlaced())
+                continue;
+            LayoutUnit& placedFloatsLogicalBottom = floatingObject->type() == FloatingObject::FloatLeft ? m_placedLeftFloatsLogicalBottom : m_placedRightFloatsLogicalBottom;
+            placedFloatsLogicalBottom = std::max(placedFloatsLogicalBottom, intervalForFloatingObject(floatingObject).high());
+        }
+        m_placedFloatsLogicalBottomIsStale = false;
+    }
+    return type == FloatingObject::FloatLeft ? m_placedLeftFloatsLogicalBottom : m_placedRightFloatsLogicalBottom;
+}
+
+void FloatingObjects::invalidateCachedLineOffsets()
+{
+    m_cachedLeftLineOffset.isValid = false;
+    m_cachedRightLineOffset.isValid = false;
+}
+
 LayoutUnit FloatingObjects::logicalLeftOffsetForPositioningFloat(LayoutUnit fixedOffset, LayoutUnit logicalTop, LayoutUnit *heightRemaining)
 {
+    if (logicalTop >= placedFloatsLogicalBottom(FloatingObject::FloatLeft)) {
+        if (heightRemaining)
+            *heightRemaining = LayoutUnit::fromPixel(1);
+        return fixedOffset;
+    }
+
     ComputeFloatOffsetForFloatLayoutAdapter<FloatingObject::FloatLeft> adapter(m_renderer, logicalTop, logicalTop, fixedOffset);
     if (const FloatingObjectTree* placedFloatsTree = this->placedFloatsTree())
         placedFloatsTree->allOverlapsWithAdapter(adapter);
@@ -402,6 +452,12 @@ LayoutUnit FloatingObjects::logicalLeftOffsetForPositioningFloat(LayoutUnit fixe
 
 LayoutUnit FloatingObjects::logicalRightOffsetForPositioningFloat(LayoutUnit fixedOffset, LayoutUnit logicalTop, LayoutUnit *heightRemaining)
 {
+    if (logicalTop >= placedFloatsLogicalBottom(FloatingObject::FloatRight)) {
+        if (heightRemaining)
+            *heightRemaining = LayoutUnit::fromPixel(1);
+        return fixedOffset;
+    }
+
     ComputeFloatOffsetForFloatLayoutAdapter<FloatingObject::FloatRight> adapter(m_renderer, logicalTop, logicalTop, fixedOffset);
     if (const FloatingObjectTree* placedFloatsTree = this->placedFloatsTree())
         placedFloatsTree->allOverlapsWithAdapter(adapter);
@@ -414,20 +470,35 @@ LayoutUnit FloatingObjects::logicalRightOffsetForPositioningFloat(LayoutUnit fix
 
 LayoutUnit FloatingObjects::logicalLeftOffset(LayoutUnit fixedOffset, LayoutUnit logicalTop, LayoutUnit logicalHeight)
 {
+    if (logicalTop >= placedFloatsLogicalBottom(FloatingObject::FloatLeft))
+        return fixedOffset;
+
+    if (m_cachedLeftLineOffset.matches(fixedOffset, logicalTop, logicalHeight))
+        return m_cachedLeftLineOffset.offset;
+
     ComputeFloatOffsetForLineLayoutAdapter<FloatingObject::FloatLeft> adapter(m_renderer, logicalTop, logicalTop + logicalHeight, fixedOffset);
     if (const FloatingObjectTree* placedFloatsTree = this->placedFloatsTree())
         placedFloatsTree->allOverlapsWithAdapter(adapter);
 
+    m_cachedLeftLineOffset.set(fixedOffset, logicalTop, logicalHeight, adapter.offset());
     return adapter.offset();
 }
 
 LayoutUnit FloatingObjects::logicalRightOffset(LayoutUnit fixedOffset, LayoutUnit logicalTop, LayoutUnit logicalHeight)
 {
+    if (logicalTop >= placedFloatsLogicalBottom(FloatingObject::FloatRight))
+        return fixedOffset;
+
+    if (m_cachedRightLineOffset.matches(fixedOffset, logicalTop, logicalHeight))
+        return m_cachedRightLineOffset.offset;
+
     ComputeFloatOffsetForLineLayoutAdapter<FloatingObject::FloatRight> adapter(m_renderer, logicalTop, logicalTop + logicalHeight, fixedOffset);
     if (const FloatingObjectTree* placedFloatsTree = this->placedFloatsTree())
         placedFloatsTree->allOverlapsWithAdapter(adapter);
 
-    return std::min(fixedOffset, adapter.offset());
+    LayoutUnit offset = std::min(fixedOffset, adapter.offset());
+    m_cachedRightLineOffset.set(fixedOffset, logicalTop, logicalHeight, offset);
+    return offset;
 }
 
 template<>
@@ -149,17 +149,54 @@ public:
     LayoutUnit findNextFloatLogicalBottomBelowForBlock(LayoutUnit logicalHeight);
 
 private:
+    struct CachedLineOffset {
+        CachedLineOffset()
+            : isValid(false)
+        {
+        }
+
+        bool matches(LayoutUnit otherFixedOffset, LayoutUnit otherLogicalTop, LayoutUnit otherLogicalHeight) const
+        {
+            return isValid && fixedOffset == otherFixedOffset && logicalTop == otherLogicalTop && logicalHeight == otherLogicalHeight;
+        }
+
+        void set(LayoutUnit newFixedOffset, LayoutUnit newLogicalTop, LayoutUnit newLogicalHeight, LayoutUnit newOffset)
+        {
+            fixedOffset = newFixedOffset;
+            logicalTop = newLogicalTop;
+            logicalHeight = newLogicalHeight;
+            offset = newOffset;
+            isValid = true;
+        }
+
+        LayoutUnit fixedOffset;
+        LayoutUnit logicalTop;
+        LayoutUnit logicalHeight;
+        LayoutUnit offset;
+        bool isValid;
+    };
+
     void computePlacedFloatsTree();
     const FloatingObjectTree* placedFloatsTree();
     void increaseObjectsCount(FloatingObject::Type);
     void decreaseObjectsCount(FloatingObject::Type);
     FloatingObjectInterval intervalForFloatingObject(FloatingObject*);
+    LayoutUnit placedFloatsLogicalBottom(FloatingObject::Type);
+    void invalidateCachedLineOffsets();
 
     FloatingObjectSet m_set;
     std::unique_ptr<FloatingObjectTree> m_placedFloatsTree;
     unsigned m_leftObjectsCount;
     unsigned m_rightObjectsCount;
     bool m_horizontalWritingMode;
+    // The lowest interval end of the placed floats of each type. A line or float starting at or below it can't
+    // intersect any of them, which is the common case once the text has flowed past the floats.
+    LayoutUnit m_placedLeftFloatsLogicalBottom;
+    LayoutUnit m_placedRightFloatsLogicalBottom;
+    bool m_placedFloatsLogicalBottomIsStale;
+    // Line layout asks for the same band several times per line (to break the line, then to align it).
+    CachedLineOffset m_cachedLeftLineOffset;
+    CachedLineOffset m_cachedRightLineOffset;
     const RenderBlockFlow& m_renderer;
 };
 
@@ -24,6 +24,7 @@
 #include "config.h"
 #include "RenderBlockFlow.h"
 
+#include "DocumentMarkerController.h"
 #include "Editor.h"
 #include "FloatingObjects.h"
 #include "Frame.h"
@@ -433,6 +434,8 @@ void RenderBlockFlow::layoutBlock(bool relayoutChildren, LayoutUnit pageLogicalH
     if (!relayoutChildren && simplifiedLayout())
         return;
 
+    ++view().layoutStatistics().blockFlowLayoutCount;
+
     LayoutRepainter repainter(*this, checkForRepaintDuringLayout());
 
     if (recomputeLogicalWidthAndColumnWidth())
@@ -3080,6 +3083,8 @@ void RenderBlockFlow::setSelectionState(SelectionState state)
     if (state != SelectionNone)
         ensureLineBoxes();
     RenderBoxModelObject::setSelectionState(state);
+    if (state == SelectionNone)
+        lineBoxesMayNoLongerBeRequired();
 }
 
 GapRects RenderBlockFlow::inlineSelectionGaps(RenderBlock& rootBlock, const LayoutPoint& rootBlockPhysicalPosition, const LayoutSize& offsetFromRootBlock,
@@ -3540,8 +3545,14 @@ void RenderBlockFlow::invalidateLineLayoutPath()
 {
     switch (lineLayoutPath()) {
     case UndeterminedPath:
+        ASSERT(!m_simpleLineLayout);
+        return;
     case ForceLineBoxesPath:
         ASSERT(!m_simpleLineLayout);
+        // Line boxes were materialized on demand. Let the next layout fall back to simple lines if nothing needs them anymore;
+        // callers that query inline boxes will materialize them again through ensureLineBoxes().
+        if (!lineBoxesAreRequired())
+            setLineLayoutPath(UndeterminedPath);
         return;
     case LineBoxesPath:
         ASSERT(!m_simpleLineLayout);
@@ -3587,6 +3598,38 @@ void RenderBlockFlow::deleteLineBoxesBeforeSimpleLineLayout()
     }
 }
 
+void RenderBlockFlow::lineBoxesMayNoLongerBeRequired()
+{
+    if (lineLayoutPath() != ForceLineBoxesPath || documentBeingDestroyed() || view().frameView().isInLayout())
+        return;
+    if (lineBoxesAreRequired())
+        return;
+    // Relayout with simple lines so the inline box tree is released now rather than on the next content or style change.
+    setLineLayoutPath(UndeterminedPath);
+    setNeedsLayout();
+}
+
+bool RenderBlockFlow::lineBoxesAreRequired() const
+{
+    // Editing queries caret positions after every change; keep the line boxes rather than rebuilding them per keystroke.
+    if (style().userModify() != READ_ONLY)
+        return true;
+    if (selectionState() != SelectionNone)
+        return true;
+    bool documentHasMarkers = document().markers().hasMarkers();
+    for (auto& renderer : childrenOfType<RenderObject>(*this)) {
+        if (renderer.selectionState() != SelectionNone)
+            return true;
+        if (documentHasMarkers && is<RenderText>(renderer)) {
+            if (auto* textNode = downcast<RenderText>(renderer).textNode()) {
+                if (!document().markers().markersFor(textNode).isEmpty())
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
 void RenderBlockFlow::ensureLineBoxes()
 {
     setLineLayoutPath(ForceLineBoxesPath);
@@ -1920,12 +1920,34 @@ bool RenderBlockFlow::lineWidthForPaginatedLineChanged(RootInlineBox* rootBox, L
 
 bool RenderBlockFlow::matchedEndLine(LineLayoutState& layoutState, const InlineBidiResolver& resolver, const InlineIterator& endLineStart, const BidiStatus& endLineStatus)
 {
+    if (!layoutState.endLine())
+        return false;
+
     if (resolver.position() == endLineStart) {
         if (resolver.status() != endLineStatus)
             return false;
         return checkPaginationAndFloatsAtEndLine(layoutState);
     }
 
+    // Clean lines that break earlier in the same renderer than where we are now can never match, since
+    // the new lines only move forward. Drop them, so that the window below keeps up with the layout instead
+    // of staying anchored at the first clean line. Otherwise an edit that shifts more than a handful of
+    // lines in a long paragraph would never sync up again and all the following lines would be rebuilt.
+    RootInlineBox* firstCandidateLine = layoutState.endLine();
+    RootInlineBox* lastSkippedLine = nullptr;
+    while (firstCandidateLine && firstCandidateLine->lineBreakObj() == resolver.position().renderer() && firstCandidateLine->lineBreakPos() < resolver.position().offset()) {
+        lastSkippedLine = firstCandidateLine;
+        firstCandidateLine = firstCandidateLine->nextRootBox();
+    }
+    if (lastSkippedLine) {
+        LayoutUnit endLineLogicalTop = lastSkippedLine->lineBottomWithLeading();
+        deleteLineRange(layoutState, layoutState.endLine(), firstCandidateLine);
+        layoutState.setEndLine(firstCandidateLine);
+        if (!firstCandidateLine)
+            return false;
+        layoutState.setEndLineLogicalTop(endLineLogicalTop);
+    }
+
     // The first clean line doesn't match, but we can check a handful of following lines to try
     // to match back up.
     static const int numLines = 8; // The # of lines we're willing to match against.
@@ -624,6 +624,16 @@ void RenderBox::absoluteQuads(Vector<FloatQuad>& quads, bool* wasFixed) const
     if (flowThread && flowThread->absoluteQuadsForBox(quads, wasFixed, this, localRect.y(), localRect.maxY()))
         return;
 
+    LayoutSize absoluteOffset;
+    if (view().absoluteOffsetForGeometryQuery(*this, absoluteOffset)) {
+        FloatQuad quad(localRect);
+        quad.move(absoluteOffset);
+        quads.append(quad);
+        if (wasFixed)
+            *wasFixed = false;
+        return;
+    }
+
     quads.append(localToAbsoluteQuad(localRect, UseTransforms, wasFixed));
 }
 
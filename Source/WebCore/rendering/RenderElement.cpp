@@ -436,6 +436,10 @@ void RenderElement::setStyle(Ref<RenderStyle>&& style, StyleDifference minimalSt
 
     diff = adjustStyleDifference(diff, contextSensitiveProperties);
 
+    // Changes that don't need layout, like a new transform, can still move this subtree.
+    if (diff != StyleDifferenceEqual || contextSensitiveProperties != ContextSensitivePropertyNone)
+        view().invalidateAbsoluteOffsetCache();
+
     styleWillChange(diff, style.get());
 
     Ref<RenderStyle> oldStyle(m_style.replace(WTF::move(style)));
@@ -70,6 +70,7 @@ RenderFlexibleBox::RenderFlexibleBox(Element& element, Ref<RenderStyle>&& style)
     : RenderBlock(element, WTF::move(style), 0)
     , m_orderIterator(*this)
     , m_numberOfInFlowChildrenOnFirstLine(-1)
+    , m_flexItemLayoutCount(0)
 {
     setChildrenInline(false); // All of our children must be block-level.
 }
@@ -78,6 +79,7 @@ RenderFlexibleBox::RenderFlexibleBox(Document& document, Ref<RenderStyle>&& styl
     : RenderBlock(document, WTF::move(style), 0)
     , m_orderIterator(*this)
     , m_numberOfInFlowChildrenOnFirstLine(-1)
+    , m_flexItemLayoutCount(0)
 {
     setChildrenInline(false); // All of our children must be block-level.
 }
@@ -228,6 +230,9 @@ void RenderFlexibleBox::styleDidChange(StyleDifference diff, const RenderStyle*
 {
     RenderBlock::styleDidChange(diff, oldStyle);
 
+    if (diff == StyleDifferenceLayout)
+        m_intrinsicMainAxisExtents.clear();
+
     if (oldStyle && (oldStyle->alignItemsPosition() == ItemPositionStretch || oldStyle->alignItemsPosition() == ItemPositionAuto) && diff == StyleDifferenceLayout) {
         // Flex items that were previously stretching need to be relayed out so we can compute new available cross axis space.
         // This is only necessary for stretching since other alignment values don't change the size of the box.
@@ -246,11 +251,17 @@ void RenderFlexibleBox::layoutBlock(bool relayoutChildren, LayoutUnit)
     if (!relayoutChildren && simplifiedLayout())
         return;
 
+    ++view().layoutStatistics().flexibleBoxLayoutCount;
+
     LayoutRepainter repainter(*this, checkForRepaintDuringLayout());
 
     if (recomputeLogicalWidth())
         relayoutChildren = true;
 
+    // Every item is going to be laid out again, so none of the measurements from earlier passes can be trusted.
+    if (relayoutChildren)
+        m_intrinsicMainAxisExtents.clear();
+
     LayoutUnit previousHeight = logicalHeight();
     setLogicalHeight(borderAndPaddingLogicalHeight() + scrollbarLogicalHeight());
 
@@ -297,6 +308,13 @@ void RenderFlexibleBox::layoutBlock(bool relayoutChildren, LayoutUnit)
     clearNeedsLayout();
 }
 
+void RenderFlexibleBox::removeChild(RenderObject& oldChild)
+{
+    if (is<RenderBox>(oldChild))
+        m_intrinsicMainAxisExtents.remove(&downcast<RenderBox>(oldChild));
+    RenderBlock::removeChild(oldChild);
+}
+
 void RenderFlexibleBox::appendChildFrameRects(ChildFrameRects& childFrameRects)
 {
     for (RenderBox* child = m_orderIterator.first(); child; child = m_orderIterator.next()) {
@@ -455,7 +473,7 @@ Optional<LayoutUnit> RenderFlexibleBox::computeMainAxisExtentForChild(RenderBox&
         // We don't have to check for "auto" here - computeContentLogicalHeight will just return Nullopt for that case anyway.
         if (size.isIntrinsic())
             child.layoutIfNeeded();
-        return child.computeContentLogicalHeight(sizeType, size, child.logicalHeight() - child.borderAndPaddingLogicalHeight());
+        return child.computeContentLogicalHeight(sizeType, size, intrinsicContentLogicalHeightForChild(child));
     }
     // FIXME: Figure out how this should work for regions and pass in the appropriate values.
     RenderRegion* region = nullptr;
@@ -661,22 +679,58 @@ LayoutUnit RenderFlexibleBox::mainAxisScrollbarExtentForChild(RenderBox& child)
     return isHorizontalFlow() ? child.verticalScrollbarWidth() : child.horizontalScrollbarHeight();
 }
 
+bool RenderFlexibleBox::canCacheIntrinsicMainAxisExtent(RenderBox& child) const
+{
+    // The logical width of a child that is perpendicular to us depends on our height, which is not known until our
+    // items have been laid out, so only children sharing our writing mode are measured against a stable constraint.
+    return hasOrthogonalFlow(child) && child.isHorizontalWritingMode() == isHorizontalWritingMode();
+}
+
+LayoutUnit RenderFlexibleBox::intrinsicContentLogicalHeightForChild(RenderBox& child) const
+{
+    // A child whose measurement was reused from an earlier layout still has the height it was flexed to, so resolve
+    // intrinsic sizes against the measured extent instead.
+    if (child.hasOverrideLogicalContentHeight()) {
+        auto it = m_intrinsicMainAxisExtents.find(&child);
+        if (it != m_intrinsicMainAxisExtents.end())
+            return it->value.contentExtent;
+    }
+    return child.logicalHeight() - child.borderAndPaddingLogicalHeight();
+}
+
 LayoutUnit RenderFlexibleBox::preferredMainAxisContentExtentForChild(RenderBox& child, bool hasInfiniteLineLength)
 {
+    Length flexBasis = flexBasisForChild(child);
+    bool usesContentExtent = flexBasis.isAuto() || (flexBasis.isFixed() && !flexBasis.value() && hasInfiniteLineLength);
+    bool canCacheExtent = usesContentExtent && canCacheIntrinsicMainAxisExtent(child);
+
+    // Measuring an orthogonal child means laying it out without its flexed size and then laying it out again once it
+    // has been flexed, which doubles the work at every level of nested flexboxes. Reuse the previous measurement as
+    // long as neither the child nor the constraints it was measured under have changed.
+    if (canCacheExtent && !child.needsLayout()) {
+        auto it = m_intrinsicMainAxisExtents.find(&child);
+        if (it != m_intrinsicMainAxisExtents.end() && it->value.availableLogicalWidth == availableLogicalWidth() && it->value.isStretched == needToStretchChild(child))
+            return it->value.contentExtent;
+    }
+
     bool hasOverrideSize = child.hasOverrideLogicalContentWidth() || child.hasOverrideLogicalContentHeight();
     if (hasOverrideSize)
         child.clearOverrideSize();
 
-    Length flexBasis = flexBasisForChild(child);
-    if (flexBasis.isAuto() || (flexBasis.isFixed() && !flexBasis.value() && hasInfiniteLineLength)) {
+    if (usesContentExtent) {
         if (hasOrthogonalFlow(child)) {
             if (hasOverrideSize)
                 child.setChildNeedsLayout(MarkOnlyThis);
+            if (child.needsLayout())
+                ++m_flexItemLayoutCount;
             child.layoutIfNeeded();
         }
         LayoutUnit mainAxisExtent = hasOrthogonalFlow(child) ? child.logicalHeight() : child.maxPreferredLogicalWidth();
         ASSERT(mainAxisExtent - mainAxisBorderAndPaddingExtentForChild(child) >= 0);
-        return mainAxisExtent - mainAxisBorderAndPaddingExtentForChild(child);
+        LayoutUnit contentExtent = mainAxisExtent - mainAxisBorderAndPaddingExtentForChild(child);
+        if (canCacheExtent)
+            m_intrinsicMainAxisExtents.set(&child, IntrinsicMainAxisExtent { availableLogicalWidth(), needToStretchChild(child), contentExtent });
+        return contentExtent;
     }
     return computeMainAxisExtentForChild(child, MainOrPreferredSize, flexBasis).valueOr(0);
 }
@@ -1126,6 +1180,8 @@ void RenderFlexibleBox::layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, cons
             resetAutoMarginsAndLogicalTopInCrossAxis(child);
         }
         updateBlockChildDirtyBitsBeforeLayout(relayoutChildren, child);
+        if (child.needsLayout())
+            ++m_flexItemLayoutCount;
         child.layoutIfNeeded();
 
         updateAutoMarginsInMainAxis(child, autoMarginOffset);
@@ -1380,6 +1436,7 @@ void RenderFlexibleBox::applyStretchAlignmentToChild(RenderBox& child, LayoutUni
                 child.setOverrideLogicalContentHeight(desiredLogicalHeight - child.borderAndPaddingLogicalHeight());
                 child.setLogicalHeight(0);
                 child.setChildNeedsLayout(MarkOnlyThis);
+                ++m_flexItemLayoutCount;
                 child.layout();
             }
         }
@@ -1392,6 +1449,7 @@ void RenderFlexibleBox::applyStretchAlignmentToChild(RenderBox& child, LayoutUni
             if (childWidth != child.logicalWidth()) {
                 child.setOverrideLogicalContentWidth(childWidth - child.borderAndPaddingLogicalWidth());
                 child.setChildNeedsLayout(MarkOnlyThis);
+                ++m_flexItemLayoutCount;
                 child.layout();
             }
         }
@@ -47,6 +47,7 @@ public:
     virtual bool avoidsFloats() const override final { return true; }
     virtual bool canCollapseAnonymousBlockChild() const override final { return false; }
     virtual void layoutBlock(bool relayoutChildren, LayoutUnit pageLogicalHeight = 0) override final;
+    virtual void removeChild(RenderObject&) override;
 
     virtual int baselinePosition(FontBaseline, bool firstLine, LineDirectionMode, LinePositionMode = PositionOnContainingLine) const override;
     virtual Optional<int> firstLineBaseline() const override;
@@ -56,6 +57,9 @@ public:
 
     bool isHorizontalFlow() const;
 
+    // Number of times this flexbox has laid out one of its items, either to measure it or to give it its flexed size.
+    unsigned flexItemLayoutCount() const { return m_flexItemLayoutCount; }
+
     virtual bool isTopLayoutOverflowAllowed() const override;
     virtual bool isLeftLayoutOverflowAllowed() const override;
 
@@ -77,6 +81,15 @@ private:
     };
 
     typedef HashMap<const RenderBox*, LayoutUnit> InflexibleFlexItemSize;
+
+    // Content extent an orthogonal flex item had when laid out without an override size, together with
+    // the constraints it was measured under.
+    struct IntrinsicMainAxisExtent {
+        LayoutUnit availableLogicalWidth;
+        bool isStretched;
+        LayoutUnit contentExtent;
+    };
+    typedef HashMap<const RenderBox*, IntrinsicMainAxisExtent> IntrinsicMainAxisExtentMap;
     typedef Vector<RenderBox*> OrderedFlexItemList;
 
     struct LineContext;
@@ -122,6 +135,8 @@ private:
     LayoutUnit mainAxisBorderAndPaddingExtentForChild(RenderBox& child) const;
     LayoutUnit mainAxisScrollbarExtentForChild(RenderBox& child) const;
     LayoutUnit preferredMainAxisContentExtentForChild(RenderBox& child, bool hasInfiniteLineLength);
+    bool canCacheIntrinsicMainAxisExtent(RenderBox& child) const;
+    LayoutUnit intrinsicContentLogicalHeightForChild(RenderBox& child) const;
     EOverflow mainAxisOverflowForChild(RenderBox&) const;
 
     void layoutFlexItems(bool relayoutChildren, Vector<LineContext>&);
@@ -165,6 +180,8 @@ private:
 
     mutable OrderIterator m_orderIterator;
     int m_numberOfInFlowChildrenOnFirstLine;
+    IntrinsicMainAxisExtentMap m_intrinsicMainAxisExtents;
+    unsigned m_flexItemLayoutCount;
 };
 
 } // namespace WebCore
@@ -145,7 +145,7 @@ void RenderGeometryMap::pushMappingsToAncestor(const RenderObject* renderer, con
         renderer = renderer->pushMappingToContainer(ancestorRenderer, *this);
     } while (renderer && renderer != ancestorRenderer);
 
-    ASSERT(m_mapping.isEmpty() || m_mapping[0].m_renderer->isRenderView());
+    ASSERT(m_mapping.isEmpty() || ancestorRenderer || m_mapping[0].m_renderer->isRenderView());
 }
 
 static bool canMapBetweenRenderersViaLayers(const RenderLayerModelObject& renderer, const RenderLayerModelObject& ancestor)
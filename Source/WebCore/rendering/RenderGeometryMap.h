@@ -80,6 +80,10 @@ public:
 
     MapCoordinatesFlags mapCoordinatesFlags() const { return m_mapCoordinatesFlags; }
 
+    // True if mapping through the pushed steps is a plain translation by accumulatedOffset().
+    bool mapsByOffset() const { return !hasFixedPositionStep() && !hasTransformStep() && !hasNonUniformStep(); }
+    LayoutSize accumulatedOffset() const { return m_accumulatedOffset; }
+
     FloatPoint absolutePoint(const FloatPoint& p) const
     {
         return mapToContainer(p, nullptr);
@@ -2378,6 +2378,7 @@ void RenderLayer::scrollTo(int x, int y)
     
     IntPoint oldPosition = IntPoint(m_scrollOffset);
     m_scrollOffset = newScrollOffset;
+    renderer().view().invalidateAbsoluteOffsetCache();
 
     InspectorInstrumentation::willScrollLayer(renderer().frame());
 
@@ -119,7 +119,8 @@ void RenderTable::styleDidChange(StyleDifference diff, const RenderStyle* oldSty
             m_tableLayout = std::make_unique<FixedTableLayout>(this);
         else
             m_tableLayout = std::make_unique<AutoTableLayout>(this);
-    }
+    } else
+        m_tableLayout->setNeedsFullRecalc();
 
     // If border was changed, invalidate collapsed borders cache.
     if (oldStyle && oldStyle->border() != style().border())
@@ -252,11 +253,15 @@ void RenderTable::invalidateCachedColumnOffsets()
 void RenderTable::addColumn(const RenderTableCol*)
 {
     invalidateCachedColumns();
+    if (m_tableLayout)
+        m_tableLayout->setNeedsFullRecalc();
 }
 
 void RenderTable::removeColumn(const RenderTableCol*)
 {
     invalidateCachedColumns();
+    if (m_tableLayout)
+        m_tableLayout->setNeedsFullRecalc();
     // We don't really need to recompute our sections, but we need to update our
     // column count and whether we have a column. Currently, we only have one
     // size-fit-all flag but we may have to consider splitting it.
@@ -427,6 +432,8 @@ void RenderTable::layout()
     if (simplifiedLayout())
         return;
 
+    ++view().layoutStatistics().tableLayoutCount;
+
     recalcSectionsIfNeeded();
     // FIXME: We should do this recalc lazily in borderStart/borderEnd so that we don't have to make sure
     // to call this before we call borderStart/borderEnd to avoid getting a stale value.
@@ -1010,6 +1017,8 @@ void RenderTable::recalcSections() const
     m_foot = 0;
     m_firstBody = 0;
     m_hasColElements = false;
+    if (m_tableLayout)
+        m_tableLayout->setNeedsFullRecalc();
     m_hasCellColspanThatDeterminesTableWidth = hasCellColspanThatDeterminesTableWidth();
 
     // We need to get valid pointers to caption, head, foot and first body again
@@ -1222,6 +1222,7 @@ void RenderView::pushLayoutState(RenderObject& root)
 
     m_layoutState = std::make_unique<LayoutState>(root);
     pushLayoutStateForCurrentFlowThread(root);
+    ++m_layoutStatistics.layoutStatePushCount;
 }
 
 bool RenderView::shouldDisableLayoutStateForSubtree(RenderObject* renderer) const
@@ -1235,6 +1236,61 @@ bool RenderView::shouldDisableLayoutStateForSubtree(RenderObject* renderer) cons
     return false;
 }
 
+bool RenderView::absoluteOffsetForGeometryQuery(const RenderLayerModelObject& renderer, LayoutSize& offset)
+{
+    // Offsets are only stable outside of layout. Renderers can't be destroyed without dirtying layout,
+    // and the cache is cleared when layout starts, so no stale entry outlives its renderer.
+    if (frameView().needsLayout() || frameView().isInLayout())
+        return false;
+    return cachedAbsoluteOffset(renderer, offset);
+}
+
+bool RenderView::cachedAbsoluteOffset(const RenderLayerModelObject& renderer, LayoutSize& offset)
+{
+    auto it = m_absoluteOffsetCache.find(&renderer);
+    if (it != m_absoluteOffsetCache.end()) {
+        offset = it->value.offset;
+        return it->value.isTranslation;
+    }
+
+    bool isTranslation = computeAbsoluteOffset(renderer, offset);
+    m_absoluteOffsetCache.add(&renderer, CachedAbsoluteOffset { offset, isTranslation });
+    return isTranslation;
+}
+
+bool RenderView::computeAbsoluteOffset(const RenderLayerModelObject& renderer, LayoutSize& offset)
+{
+    // Fixed and sticky offsets change when the view scrolls, flipped blocks need a container flip, and flow threads map per point.
+    const RenderStyle& style = renderer.style();
+    if (style.hasViewportConstrainedPosition() || style.isFlippedBlocksWritingMode() || renderer.flowThreadState() != NotInsideFlowThread)
+        return false;
+
+    RenderGeometryMap geometryMap;
+    if (&renderer == this) {
+        // The view maps by a transform when the page is scaled.
+        geometryMap.pushMappingsToAncestor(this, nullptr);
+        offset = LayoutSize();
+        return geometryMap.mapsByOffset();
+    }
+
+    auto* container = renderer.container();
+    if (!is<RenderLayerModelObject>(container))
+        return false;
+
+    // Memoize the container first so that siblings only pay for their own step.
+    auto& layerModelContainer = downcast<RenderLayerModelObject>(*container);
+    LayoutSize containerOffset;
+    if (!cachedAbsoluteOffset(layerModelContainer, containerOffset))
+        return false;
+
+    geometryMap.pushMappingsToAncestor(&renderer, &layerModelContainer);
+    if (!geometryMap.mapsByOffset())
+        return false;
+
+    offset = containerOffset + geometryMap.accumulatedOffset();
+    return true;
+}
+
 IntSize RenderView::viewportSizeForCSSViewportUnits() const
 {
     return frameView().viewportSizeForCSSViewportUnits();
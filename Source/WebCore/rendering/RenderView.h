@@ -29,6 +29,7 @@
 #include "RenderWidget.h"
 #include "SelectionSubtreeRoot.h"
 #include <memory>
+#include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
 
 #if ENABLE(SERVICE_CONTROLS)
@@ -146,6 +147,23 @@ public:
     bool layoutStateEnabled() const { return m_layoutStateDisableCount == 0 && m_layoutState; }
     LayoutState* layoutState() const { return m_layoutState.get(); }
 
+    // Counts full (not simplified) layouts of the main layout engines and LayoutState pushes, for measuring where layout time goes.
+    struct LayoutStatistics {
+        unsigned blockFlowLayoutCount { 0 };
+        unsigned tableLayoutCount { 0 };
+        unsigned flexibleBoxLayoutCount { 0 };
+        unsigned gridLayoutCount { 0 };
+        unsigned layoutStatePushCount { 0 };
+    };
+    LayoutStatistics& layoutStatistics() { return m_layoutStatistics; }
+    void resetLayoutStatistics() { m_layoutStatistics = LayoutStatistics(); }
+
+    // Memoizes the offset to absolute coordinates of renderers whose mapping is a plain translation, so batched
+    // geometry queries from script (getBoundingClientRect() and friends) don't walk to the root for every element.
+    // Cleared when layout starts, on style changes and when an overflow area scrolls.
+    bool absoluteOffsetForGeometryQuery(const RenderLayerModelObject&, LayoutSize&);
+    void invalidateAbsoluteOffsetCache() { m_absoluteOffsetCache.clear(); }
+
     virtual void updateHitTestResult(HitTestResult&, const LayoutPoint&) override;
 
     LayoutUnit pageLogicalHeight() const { return m_pageLogicalHeight; }
@@ -278,6 +296,7 @@ private:
             || m_layoutState->lineGrid() || (renderer.style().lineGrid() != RenderStyle::initialLineGrid() && renderer.isRenderBlockFlow())) {
             m_layoutState = std::make_unique<LayoutState>(WTF::move(m_layoutState), &renderer, offset, pageHeight, pageHeightChanged);
             pushLayoutStateForCurrentFlowThread(renderer);
+            ++m_layoutStatistics.layoutStatePushCount;
             return true;
         }
         return false;
@@ -358,6 +377,9 @@ private:
 
     void lazyRepaintTimerFired();
 
+    bool cachedAbsoluteOffset(const RenderLayerModelObject&, LayoutSize&);
+    bool computeAbsoluteOffset(const RenderLayerModelObject&, LayoutSize&);
+
     Timer m_lazyRepaintTimer;
     HashSet<RenderBox*> m_renderersNeedingLazyRepaint;
 
@@ -366,6 +388,14 @@ private:
     bool m_pageLogicalHeightChanged;
     std::unique_ptr<LayoutState> m_layoutState;
     unsigned m_layoutStateDisableCount;
+    LayoutStatistics m_layoutStatistics;
+
+    struct CachedAbsoluteOffset {
+        LayoutSize offset;
+        bool isTranslation;
+    };
+    HashMap<const RenderLayerModelObject*, CachedAbsoluteOffset> m_absoluteOffsetCache;
+
     std::unique_ptr<RenderLayerCompositor> m_compositor;
     std::unique_ptr<FlowThreadController> m_flowThreadController;
 
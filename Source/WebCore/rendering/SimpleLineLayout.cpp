@@ -132,8 +132,10 @@ bool canUseFor(const RenderBlockFlow& flow)
     // Non-visible overflow should be pretty easy to support.
     if (style.overflowX() != OVISIBLE || style.overflowY() != OVISIBLE)
         return false;
-    if (!style.textIndent().isZero())
+#if ENABLE(CSS3_TEXT)
+    if (style.textIndentLine() != TextIndentFirstLine || style.textIndentType() != TextIndentNormal)
         return false;
+#endif
     if (!style.wordSpacing().isZero() || style.letterSpacing())
         return false;
     if (!style.isLeftToRightDirection())
@@ -177,6 +179,9 @@ bool canUseFor(const RenderBlockFlow& flow)
 
     // We can't use the code path if any lines would need to be shifted below floats. This is because we don't keep per-line y coordinates.
     if (flow.containsFloats()) {
+        // The indented first line has a different available width. Keep it simple and bail out.
+        if (!style.textIndent().isZero())
+            return false;
         float minimumWidthNeeded = std::numeric_limits<float>::max();
         for (const auto& textRenderer : childrenOfType<RenderText>(flow)) {
             minimumWidthNeeded = std::min(minimumWidthNeeded, textRenderer.minLogicalWidth());
@@ -428,12 +433,12 @@ static void removeTrailingWhitespace(LineState& lineState, Layout::RunVector& ru
     lineState.removeTrailingWhitespace(runs);
 }
 
-static void updateLineConstrains(const RenderBlockFlow& flow, LineState& line)
+static void updateLineConstrains(const RenderBlockFlow& flow, LineState& line, bool shouldIndentText)
 {
     LayoutUnit height = flow.logicalHeight();
     LayoutUnit logicalHeight = flow.minLineHeightForReplacedRenderer(false, 0);
-    float logicalRightOffset = flow.logicalRightOffsetForLine(height, false, logicalHeight);
-    line.setLogicalLeftOffset(flow.logicalLeftOffsetForLine(height, false, logicalHeight));
+    float logicalRightOffset = flow.logicalRightOffsetForLine(height, shouldIndentText, logicalHeight);
+    line.setLogicalLeftOffset(flow.logicalLeftOffsetForLine(height, shouldIndentText, logicalHeight));
     line.setAvailableWidth(std::max<float>(0, logicalRightOffset - line.logicalLeftOffset()));
 }
 
@@ -607,14 +612,21 @@ static void createTextRuns(Layout::RunVector& runs, RenderBlockFlow& flow, unsig
     LineState line;
     bool isEndOfContent = false;
     TextFragmentIterator textFragmentIterator = TextFragmentIterator(flow);
+    // text-indent only affects the first line. Like the line box path, an anonymous block following some other sibling
+    // still breaks its first line with the indent, but positions it without. (see RenderBlockFlow::computeInlineDirectionPositionsForLine)
+    bool isFirstLine = true;
+    bool shouldIndentFirstLinePosition = !(flow.isAnonymousBlock() && flow.parent()->firstChild() != &flow);
 
     do {
         flow.setLogicalHeight(lineHeight * lineCount + borderAndPaddingBefore);
         LineState previousLine = line;
         unsigned previousRunCount = runs.size();
         line = LineState();
-        updateLineConstrains(flow, line);
+        updateLineConstrains(flow, line, isFirstLine);
         isEndOfContent = createLineRuns(line, previousLine, runs, textFragmentIterator);
+        if (isFirstLine && !shouldIndentFirstLinePosition)
+            updateLineConstrains(flow, line, false);
+        isFirstLine = false;
         closeLineEndingAndAdjustRuns(line, runs, previousRunCount, lineCount, textFragmentIterator);
     } while (!isEndOfContent);
 }
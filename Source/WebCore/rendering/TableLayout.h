@@ -42,6 +42,9 @@ public:
     virtual void applyPreferredLogicalWidthQuirks(LayoutUnit& minWidth, LayoutUnit& maxWidth) const = 0;
     virtual void layout() = 0;
 
+    // Called when the table structure or the table's own style changed, so that cached per-column data can't be trusted.
+    virtual void setNeedsFullRecalc() { }
+
 protected:
     // FIXME: Once we enable SATURATED_LAYOUT_ARITHMETHIC, this should just be LayoutUnit::nearlyMax().
     // Until then though, using nearlyMax causes overflow in some tests, so we just pick a large number.
@@ -47,6 +47,7 @@
 #include "DocumentMarkerController.h"
 #include "Editor.h"
 #include "Element.h"
+#include "ElementDescendantIterator.h"
 #include "EventHandler.h"
 #include "ExceptionCode.h"
 #include "ExtensionStyleSheets.h"
@@ -94,6 +95,7 @@
 #include "PseudoElement.h"
 #include "Range.h"
 #include "RenderEmbeddedObject.h"
+#include "RenderFlexibleBox.h"
 #include "RenderLayerCompositor.h"
 #include "RenderMenuList.h"
 #include "RenderTreeAsText.h"
@@ -109,6 +111,7 @@
 #include "SourceBuffer.h"
 #include "SpellChecker.h"
 #include "StaticNodeList.h"
+#include "StyleResolver.h"
 #include "StyleSheetContents.h"
 #include "TextIterator.h"
 #include "TreeScope.h"
@@ -2277,6 +2280,217 @@ unsigned long Internals::styleRecalcCount(ExceptionCode& ec)
     return document->styleRecalcCount();
 }
 
+void Internals::startTrackingSelectorFilterRejections(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return;
+    }
+    document->ensureStyleResolver().selectorFilter().resetStatistics();
+}
+
+unsigned long Internals::selectorFilterCandidateRuleCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().selectorFilter().statistics().candidateRuleCount;
+}
+
+unsigned long Internals::selectorFilterAncestorRejectionCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().selectorFilter().statistics().ancestorRejectionCount;
+}
+
+unsigned long Internals::selectorFilterSiblingRejectionCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().selectorFilter().statistics().siblingRejectionCount;
+}
+
+void Internals::startTrackingStyleSharing(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return;
+    }
+    document->ensureStyleResolver().resetStyleSharingStatistics();
+}
+
+unsigned long Internals::styleSharingIndexHitCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().styleSharingStatistics().indexHitCount;
+}
+
+unsigned long Internals::styleSharingScanHitCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().styleSharingStatistics().scanHitCount;
+}
+
+unsigned long Internals::styleSharingMissCount(const String& reason, ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    StyleResolver::StyleSharingMissReason missReason;
+    if (reason == "ElementNotShareable")
+        missReason = StyleResolver::StyleSharingMissReason::ElementNotShareable;
+    else if (reason == "NoCandidate")
+        missReason = StyleResolver::StyleSharingMissReason::NoCandidate;
+    else if (reason == "SiblingRules")
+        missReason = StyleResolver::StyleSharingMissReason::SiblingRules;
+    else if (reason == "UncommonAttributeRules")
+        missReason = StyleResolver::StyleSharingMissReason::UncommonAttributeRules;
+    else if (reason == "ParentPreventsSharing")
+        missReason = StyleResolver::StyleSharingMissReason::ParentPreventsSharing;
+    else {
+        ec = SYNTAX_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().styleSharingStatistics().missCounts[static_cast<unsigned>(missReason)];
+}
+
+void Internals::startTrackingCascade(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return;
+    }
+    document->ensureStyleResolver().resetCascadeStatistics();
+}
+
+unsigned long Internals::cascadedDeclarationCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().cascadeStatistics().cascadedDeclarationCount;
+}
+
+unsigned long Internals::appliedCascadedPropertyCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+    return document->ensureStyleResolver().cascadeStatistics().appliedPropertyCount;
+}
+
+unsigned long Internals::elementDataByteCount(const String& kind, ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    bool countShared;
+    if (kind == "Shared")
+        countShared = true;
+    else if (kind == "Unique")
+        countShared = false;
+    else {
+        ec = SYNTAX_ERR;
+        return 0;
+    }
+
+    // Shareable data is counted once no matter how many elements point to it.
+    HashSet<const ElementData*> countedSharedData;
+    size_t byteCount = 0;
+    for (auto& element : elementDescendants(*document)) {
+        const ElementData* elementData = element.elementData();
+        if (!elementData || elementData->isUnique() == countShared)
+            continue;
+        if (countShared && !countedSharedData.add(elementData).isNewEntry)
+            continue;
+        byteCount += elementData->byteSize();
+    }
+    return byteCount;
+}
+
+void Internals::startTrackingRendererLayouts(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document || !document->renderView()) {
+        ec = INVALID_ACCESS_ERR;
+        return;
+    }
+
+    document->renderView()->resetLayoutStatistics();
+}
+
+unsigned long Internals::rendererLayoutCount(const String& rendererClass, ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document || !document->renderView()) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    const RenderView::LayoutStatistics& statistics = document->renderView()->layoutStatistics();
+    if (rendererClass == "RenderBlockFlow")
+        return statistics.blockFlowLayoutCount;
+    if (rendererClass == "RenderTable")
+        return statistics.tableLayoutCount;
+    if (rendererClass == "RenderFlexibleBox")
+        return statistics.flexibleBoxLayoutCount;
+    if (rendererClass == "RenderGrid")
+        return statistics.gridLayoutCount;
+    ec = SYNTAX_ERR;
+    return 0;
+}
+
+unsigned long Internals::layoutStatePushCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document || !document->renderView()) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    return document->renderView()->layoutStatistics().layoutStatePushCount;
+}
+
+unsigned long Internals::flexItemLayoutCount(Element* element, ExceptionCode& ec)
+{
+    if (!element || !is<RenderFlexibleBox>(element->renderer())) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    return downcast<RenderFlexibleBox>(*element->renderer()).flexItemLayoutCount();
+}
+
 void Internals::startTrackingCompositingUpdates(ExceptionCode& ec)
 {
     Document* document = contextDocument();
@@ -317,6 +317,27 @@ public:
     void startTrackingStyleRecalcs(ExceptionCode&);
     unsigned long styleRecalcCount(ExceptionCode&);
 
+    void startTrackingSelectorFilterRejections(ExceptionCode&);
+    unsigned long selectorFilterCandidateRuleCount(ExceptionCode&);
+    unsigned long selectorFilterAncestorRejectionCount(ExceptionCode&);
+    unsigned long selectorFilterSiblingRejectionCount(ExceptionCode&);
+
+    void startTrackingStyleSharing(ExceptionCode&);
+    unsigned long styleSharingIndexHitCount(ExceptionCode&);
+    unsigned long styleSharingScanHitCount(ExceptionCode&);
+    unsigned long styleSharingMissCount(const String& reason, ExceptionCode&);
+
+    void startTrackingCascade(ExceptionCode&);
+    unsigned long cascadedDeclarationCount(ExceptionCode&);
+    unsigned long appliedCascadedPropertyCount(ExceptionCode&);
+
+    unsigned long elementDataByteCount(const String& kind, ExceptionCode&);
+
+    void startTrackingRendererLayouts(ExceptionCode&);
+    unsigned long rendererLayoutCount(const String& rendererClass, ExceptionCode&);
+    unsigned long layoutStatePushCount(ExceptionCode&);
+    unsigned long flexItemLayoutCount(Element*, ExceptionCode&);
+
     void startTrackingCompositingUpdates(ExceptionCode&);
     unsigned long compositingUpdateCount(ExceptionCode&);
 
@@ -114,6 +114,13 @@ void LocationPath::evaluate(NodeSet& nodes) const
         bool needToCheckForDuplicateNodes = !nodes.subtreesAreDisjoint() || (step->axis() != Step::ChildAxis && step->axis() != Step::SelfAxis
             && step->axis() != Step::DescendantAxis && step->axis() != Step::DescendantOrSelfAxis && step->axis() != Step::AttributeAxis);
 
+        // A descendant step evaluated from a context node that lies inside the subtree of an earlier context node
+        // only finds nodes that were already found. If the context nodes are in document order and the step does not
+        // depend on its context node list, such context nodes can be skipped, and the result needs no deduplication or sorting.
+        bool skipNestedContextNodes = resultIsSorted && step->axis() == Step::DescendantAxis && step->predicatesAreContextListInsensitive();
+        if (skipNestedContextNodes)
+            needToCheckForDuplicateNodes = false;
+
         if (needToCheckForDuplicateNodes)
             resultIsSorted = false;
 
@@ -121,7 +128,17 @@ void LocationPath::evaluate(NodeSet& nodes) const
         if (nodes.subtreesAreDisjoint() && (step->axis() == Step::ChildAxis || step->axis() == Step::SelfAxis))
             newNodes.markSubtreesDisjoint(true);
 
+        Node* lastContextNode = nullptr;
         for (auto& node : nodes) {
+            if (skipNestedContextNodes) {
+                // Attribute nodes have no descendants in the XPath model.
+                if (node->isAttributeNode())
+                    continue;
+                if (lastContextNode && lastContextNode->contains(node.get()))
+                    continue;
+                lastContextNode = node.get();
+            }
+
             NodeSet matches;
             step->evaluate(*node, matches);
 
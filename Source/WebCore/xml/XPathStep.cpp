@@ -30,6 +30,7 @@
 
 #include "Attr.h"
 #include "Document.h"
+#include "ElementTraversal.h"
 #include "HTMLDocument.h"
 #include "HTMLElement.h"
 #include "NodeTraversal.h"
@@ -252,6 +253,14 @@ void Step::nodesInAxis(Node& context, NodeSet& nodes) const
         case DescendantAxis:
             if (context.isAttributeNode()) // In XPath model, attribute nodes do not have children.
                 return;
+            if (m_nodeTest.m_kind == NodeTest::NameTest) {
+                // Name tests only match elements on this axis, so there is no need to visit other nodes.
+                for (Element* element = ElementTraversal::firstWithin(context); element; element = ElementTraversal::next(*element, &context)) {
+                    if (nodeMatches(*element, DescendantAxis, m_nodeTest))
+                        nodes.append(element);
+                }
+                return;
+            }
             for (Node* node = context.firstChild(); node; node = NodeTraversal::next(*node, &context)) {
                 if (nodeMatches(*node, DescendantAxis, m_nodeTest))
                     nodes.append(node);
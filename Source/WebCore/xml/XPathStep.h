@@ -102,11 +102,11 @@ public:
 
     Axis axis() const { return m_axis; }
 
+    bool predicatesAreContextListInsensitive() const;
+
 private:
     friend void optimizeStepPair(Step&, Step&, bool&);
 
-    bool predicatesAreContextListInsensitive() const;
-
     void parseNodeTest(const String&);
     void nodesInAxis(Node& context, NodeSet&) const;
 